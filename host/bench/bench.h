@@ -0,0 +1,224 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef bench_h
+#define bench_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "cycles.h"
+
+/*
+ * Microbenchmark runner: a benchmark is a body run in batches. Some batches are run first to warm up caches
+ * and branch predictors, then each repetition times one batch. Results are per call of the body, as
+ * percentiles over the repetitions, so one slow repetition (an interrupt, a page fault) doesn't move the median.
+ * The whole set is run BENCH_ROUNDS times on one CPU, and each benchmark keeps its fastest round, so a burst of
+ * other work on the machine has to last through every round to show up.
+ *
+ * A baseline file holds the expected cost of each benchmark, as its fastest repetition, and how far above it
+ * (in percent) counts as a regression. The fastest repetition is the steadiest measure when other work on the
+ * machine can only slow a repetition down:
+ *
+ *   units cycles
+ *   # name           min      threshold%
+ *   colourRamp       17.4     25
+ *
+ * A fixed calibration loop is timed alongside the benchmarks and recorded in the baseline too. Baselines are
+ * scaled by how it compares, so a machine running at another clock speed (or busier) doesn't read as a
+ * regression. Even so, baselines are best recorded on the machine (and build type) they are checked on:
+ * rerun with --update-baseline there after a deliberate change.
+ */
+
+#define BENCH_WARMUP_BATCHES    10
+#define BENCH_REPETITIONS       101
+#define BENCH_ROUNDS            10
+#define BENCH_DEFAULT_THRESHOLD 25      // Percent: a line in the baseline file can give its own
+#define BENCH_CALIBRATION       "calibration"
+#define BENCH_SPIN_UP           200000000ULL    // Cycles (or ns) busy before the first benchmark
+
+typedef struct
+{
+    std::string name;
+    double      p50;
+    double      p90;
+    double      p99;
+    double      min;
+} BENCH_RESULT;
+
+typedef struct
+{
+    std::string name;
+    double      min;
+    int         threshold;
+} BENCH_BASELINE;
+
+// Time body(i) for i = 0 .. batch-1, BENCH_REPETITIONS times
+template <typename BODY>
+BENCH_RESULT runBenchmark(const char *name, int batch, BODY body)
+{
+    std::vector<double> samples(BENCH_REPETITIONS);
+
+    for( int w = 0; w < BENCH_WARMUP_BATCHES; w++)
+    {
+        for( int i = 0; i < batch; i++) body(i);
+    }
+
+    for( int r = 0; r < BENCH_REPETITIONS; r++)
+    {
+        uint64_t start = cycleCount();
+        for( int i = 0; i < batch; i++) body(i);
+        samples[r] = (double)(cycleCount() - start) / batch;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    BENCH_RESULT result;
+    result.name = name;
+    result.min = samples[0];
+    result.p50 = samples[BENCH_REPETITIONS * 50 / 100];
+    result.p90 = samples[BENCH_REPETITIONS * 90 / 100];
+    result.p99 = samples[BENCH_REPETITIONS * 99 / 100];
+
+    return result;
+}
+
+// Keep the round with the fastest repetition for each benchmark
+static inline void benchKeepFastest(std::vector<BENCH_RESULT> *fastest, const std::vector<BENCH_RESULT> &round)
+{
+    for( const BENCH_RESULT &r : round)
+    {
+        auto f = std::find_if(fastest->begin(), fastest->end(), [&](const BENCH_RESULT &b) { return b.name == r.name; });
+
+        if( f == fastest->end()) fastest->push_back(r);
+        else if( r.min < f->min) *f = r;
+    }
+}
+
+// Run on the CPU we're on now, so the benchmarks aren't moved to a cold cache part way through: the CPU, or -1
+static inline int benchPinCpu(void)
+{
+#ifdef __linux__
+    cpu_set_t cpus;
+    int cpu = sched_getcpu();
+
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    if( cpu >= 0 && sched_setaffinity(0, sizeof(cpus), &cpus) == 0) return cpu;
+#endif
+    return -1;
+}
+
+// The calibration workload: a dependent chain of integer work and small table reads, much like the lamp code
+static inline void benchCalibration(int)
+{
+    static uint32_t table[256];
+    static uint32_t x = 1;
+
+    for( int n = 0; n < 16; n++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        table[x & 255] += x;
+        x += table[(x >> 8) & 255];
+    }
+    keep(x);
+}
+
+// Read a baseline file: false if it can't be read, or was recorded in other units
+static inline bool readBaseline(const char *path, std::vector<BENCH_BASELINE> *baseline)
+{
+    FILE *f = fopen(path, "r");
+    char line[128];
+    bool sameUnits = false;
+
+    if( !f) return false;
+
+    while( fgets(line, sizeof(line), f))
+    {
+        char name[64];
+        BENCH_BASELINE b;
+
+        b.threshold = BENCH_DEFAULT_THRESHOLD;
+
+        if( line[0] == '#') continue;
+
+        if( sscanf(line, "units %63s", name) == 1)
+        {
+            sameUnits = !strcmp(name, CYCLE_UNITS);
+        }
+        else if( sscanf(line, "%63s %lf %d", name, &b.min, &b.threshold) >= 2)
+        {
+            b.name = name;
+            baseline->push_back(b);
+        }
+    }
+
+    fclose(f);
+
+    return sameUnits;
+}
+
+// Write the results as a new baseline, keeping the thresholds from the old one
+static inline bool writeBaseline(const char *path, const std::vector<BENCH_RESULT> &results, const std::vector<BENCH_BASELINE> &old)
+{
+    FILE *f = fopen(path, "w");
+
+    if( !f) return false;
+
+    fprintf(f, "# Host benchmark baseline for lamp_bench: fastest cost per call, and the percentage above it that fails\n");
+    fprintf(f, "# Regenerate with: lamp_bench --update-baseline\n");
+    fprintf(f, "units %s\n", CYCLE_UNITS);
+
+    for( const BENCH_RESULT &r : results)
+    {
+        int threshold = BENCH_DEFAULT_THRESHOLD;
+
+        for( const BENCH_BASELINE &b : old)
+        {
+            if( b.name == r.name) threshold = b.threshold;
+        }
+
+        fprintf(f, "%-20s %10.1f %5d\n", r.name.c_str(), r.min, threshold);
+    }
+
+    fclose(f);
+
+    return true;
+}
+
+#endif
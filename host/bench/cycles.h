@@ -0,0 +1,63 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef cycles_h
+#define cycles_h
+
+#include <stdint.h>
+
+#include <chrono>
+
+// A cycle counter for the host: the TSC on x86, otherwise nanoseconds (and say so)
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+#define CYCLE_UNITS "cycles"
+
+static inline uint64_t cycleCount(void)
+{
+    return __rdtsc();
+}
+#else
+#define CYCLE_UNITS "ns"
+
+static inline uint64_t cycleCount(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+// Stop the compiler throwing away work whose result we don't use
+template <typename T>
+static inline void keep(const T &value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+#endif
@@ -0,0 +1,1691 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Checks and microbenchmarks for the lamp firmware hot paths, run against the host stand-in
+// Exits non-zero if a check fails
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <zlib.h>
+
+#include "Particle.h"
+#include "host_hal.h"
+
+#include "admin.h"
+#include "light.h"
+#include "palette.h"
+#include "pulse.h"
+#include "sequence.h"
+#include "fade.h"
+#include "greeting.h"
+#include "boot.h"
+#include "profile.h"
+#include "wifi-setup.h"
+#include "wifi-pages.h"
+#include "lan-server.h"
+#include "stream.h"
+#include "publisher.h"
+#include "state.h"
+#include "persist.h"
+#include "trace.h"
+
+#include "trace_decode.h"
+#include "frame_gen.h"
+
+#include "cycles.h"
+#include "bench.h"
+
+void setup(void);
+void loop(void);
+
+extern uint32_t seenConnections;
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool ok, const char *what)
+    {
+        printf("%-60s %s\n", what, ok ? "ok" : "FAILED");
+        if( !ok) failures++;
+    }
+
+    /*
+     * Colour mapping
+     *
+     * The float gradients the table driven ones replaced, as the reference for accuracy
+     */
+    COLOUR referenceRamp(float value, float vmin, float vmax, int bits)
+    {
+        COLOUR c;
+        double dv;
+        int maxColour = pow(2, bits) - 1;
+
+        c.r = c.g = c.b = maxColour;
+
+        if (value < vmin) value = vmin;
+        if (value > vmax) value = vmax;
+
+        dv = vmax - vmin;
+
+        if (value < (vmin + 0.25 * dv)) {
+            c.r = 0;
+            c.g = (4 * (value - vmin) / dv) * maxColour;
+        } else if (value < (vmin + 0.5 * dv)) {
+            c.r = 0;
+            c.b = maxColour + (4 * (vmin + 0.25 * dv - value) / dv) * maxColour;
+        } else if (value < (vmin + 0.75 * dv)) {
+            c.r = (4 * (value - vmin - 0.5 * dv) / dv) * maxColour;
+            c.b = 0;
+        } else {
+            c.g = maxColour + (4 * (vmin + 0.75 * dv - value) / dv) * maxColour;
+            c.b = 0;
+        }
+
+        return c;
+    }
+
+    COLOUR referenceSpectrum(float value, float vmin, float vmax, int bits)
+    {
+        COLOUR c;
+        double dv;
+        int maxColour = pow(2, bits) - 1;
+
+        if (value < vmin) value = vmin;
+        if (value > vmax) value = vmax;
+
+        dv = vmax - vmin;
+
+        if (value < (vmin + 0.25 * dv)) {
+            c.r = maxColour - ((4 * (value - vmin) / dv) * maxColour);
+            c.g = 0;
+            c.b = maxColour;
+        } else if (value < (vmin + 0.5 * dv)) {
+            c.r = 0;
+            c.g = (4 * (value - vmin - 0.25 * dv) / dv) * maxColour;
+            c.b = maxColour + (4 * (vmin + 0.25 * dv - value) / dv) * maxColour;
+        } else if (value < (vmin + 0.75 * dv)) {
+            c.r = (4 * (value - vmin - 0.5 * dv) / dv) * maxColour;
+            c.g = maxColour;
+            c.b = 0;
+        } else {
+            c.r = maxColour;
+            c.g = maxColour + (4 * (vmin + 0.75 * dv - value) / dv) * maxColour;
+            c.b = 0;
+        }
+
+        return c;
+    }
+
+    uint32_t colourError(const COLOUR &a, const COLOUR &b)
+    {
+        uint32_t e = 0;
+
+        e = std::max(e, (uint32_t)abs((int32_t)a.r - (int32_t)b.r));
+        e = std::max(e, (uint32_t)abs((int32_t)a.g - (int32_t)b.g));
+        e = std::max(e, (uint32_t)abs((int32_t)a.b - (int32_t)b.b));
+
+        return e;
+    }
+
+    void checkColourMapping(void)
+    {
+        const int bitDepths[] = { 8, 10, 12, 14, 16 };
+        const int32_t ranges[][2] = { { 0, 1024 }, { 0, 100 }, { -500, 500 }, { 0, 1 }, { 13, 977 }, { 0, 65535 }, { -40, 125 }, { 0, 1000000 } };
+
+        uint32_t worstRamp = 0;
+        uint32_t worstSpectrum = 0;
+
+        for( int bits : bitDepths)
+        {
+            lamp.setColourResolution(bits);
+
+            for( const int32_t *range : ranges)
+            {
+                int32_t span = range[1] - range[0];
+                int32_t step = span > 20000 ? span / 20000 : 1;
+
+                // Include some values outside the range, which are clipped
+                for( int32_t v = range[0] - 2 * step; v <= range[1] + 2 * step; v += step)
+                {
+                    worstRamp = std::max(worstRamp, colourError(lamp.colourRampFromRange(v, range[0], range[1]), referenceRamp(v, range[0], range[1], bits)));
+                    worstSpectrum = std::max(worstSpectrum, colourError(lamp.visibleColourFromRange(v, range[0], range[1]), referenceSpectrum(v, range[0], range[1], bits)));
+                }
+            }
+        }
+
+        printf("colour mapping: worst error against the float gradients: ramp %u, spectrum %u LSB\n", worstRamp, worstSpectrum);
+        check(worstRamp <= 1, "RAMP within 1 LSB of the float ramp");
+        check(worstSpectrum <= 1, "SPECTRUM within 1 LSB of the float spectrum");
+    }
+
+    // A palette uploaded with the same stops as RAMP has to give exactly the same colours
+    void checkPalettes(void)
+    {
+        int result = 0;
+        bool same = true;
+
+        lamp.setColourResolution(12);
+
+        host::callFunction("colour", "PALETTE 0 CLEAR", &result);
+        host::callFunction("colour", "PALETTE 0 ADD 0:0000FF 25:00FFFF 50:00FF00", &result);
+        host::callFunction("colour", "PALETTE 0 ADD 75:FFFF00 100:FF0000", &result);
+
+        for( int32_t v = -10; v <= 1010 && same; v++)
+        {
+            COLOUR p = palettes.colourFromRange(0, v, 0, 1000);
+            COLOUR r = lamp.colourRampFromRange(v, 0, 1000);
+
+            same = p.r == r.r && p.g == r.g && p.b == r.b;
+        }
+
+        check(palettes.isComplete(0) && same, "PALETTE with the RAMP stops matches RAMP");
+
+        // A bad stop, or one out of order, and none of the command's stops are added
+        int bad[3];
+        host::callFunction("colour", "PALETTE 1 CLEAR", &result);
+        host::callFunction("colour", "PALETTE 1 ADD 0:000000", &result);
+        host::callFunction("colour", "PALETTE 1 ADD 50:00FF00 100:FFFFFF 100:FF", &bad[0]);
+        host::callFunction("colour", "PALETTE 1 ADD 50:00FF00 100:FFFFFF 100:000000", &bad[1]);
+        host::callFunction("colour", "PALETTE 1 ADD 60:00FF00 40:FFFFFF", &bad[2]);
+        check(bad[0] == -1 && bad[1] == -1 && bad[2] == -1 && palettes.getNumStops(1) == 1 && !palettes.isComplete(1),
+              "a PALETTE ADD with a bad stop adds none of them");
+        host::callFunction("colour", "PALETTE 1 ADD 50:00FF00 100:FFFFFF", &result);
+        check(result == 3 && palettes.isComplete(1), "and can be sent again once it's put right");
+        host::callFunction("colour", "PALETTE 1 CLEAR", &result);
+    }
+
+    // A colour only writes the channels that change: the rest are counted as skipped
+    void checkSkippedWrites(void)
+    {
+        int result = 0;
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::clearPwmWrites();
+        uint32_t written = lamp.getPwmWrites();
+        uint32_t skipped = lamp.getSkippedPwmWrites();
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::callFunction("colour", "SET 4095 0 0", &result);
+        check(host::pwmWriteCount() == 1 && lamp.getPwmWrites() - written == 1 && lamp.getSkippedPwmWrites() - skipped == 5,
+              "only the channels that change are written");
+    }
+
+    // An atomic frame (SET 4095 0 0, LEVEL 50) changes the output once, and a corrupted one changes nothing
+    void checkCommandFrames(void)
+    {
+        int result = 0;
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::callFunction("colour", "LEVEL 100", &result);
+        host::clearPwmWrites();
+
+        host::callFunction("colour", "@EQH/DwAAAAACMhU", &result);
+        check(result == 2 && host::pwmWriteCount() == 1 && lamp.getBrightnessLevel() == 50, "atomic frame applies SET and LEVEL with one PWM write");
+
+        host::callFunction("colour", "@EQH/DwAAAAACMhA", &result);
+        check(result == -1, "frame with a bad CRC is rejected");
+    }
+
+    // Keyframes play to time from the timer: halfway through a fade, at the colour once it ends, and gone once played
+    void checkSequence(void)
+    {
+        int result = 0;
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::callFunction("colour", "SEQUENCE CLEAR", &result);
+        host::callFunction("colour", "SEQUENCE ADD 4000 0 0 1000 500", &result);
+        host::callFunction("colour", "SEQUENCE ADD 0 0 4000 0 500", &result);
+        check(result == 2 && sequenceLength == 2, "SEQUENCE ADD reports the number queued");
+
+        host::callFunction("colour", "SEQUENCE PLAY ONCE", &result);
+        host::advanceMillis(500);
+        COLOUR half = lamp.getColour();
+        host::advanceMillis(500);
+        COLOUR full = lamp.getColour();
+        host::advanceMillis(500);
+        COLOUR next = lamp.getColour();
+        host::advanceMillis(500);
+
+        check(half.r == 2000 && full.r == 4000 && next.b == 4000 && next.r == 0, "keyframes reached on time");
+        check(sequenceLength == 0 && !sequencer.isPlaying() && lamp.getColour().b == 4000, "played once, the queue empties and the last colour stays");
+
+        // A packed frame can queue several keyframes at once: 4 here, played in a loop
+        host::callFunction("colour", "@EQUAAAAAAAAKADIABaAPAAAAAAoAMgAFoA+gDwAACgAyAAUAAAAAoA8KADIABQ", &result);
+        host::callFunction("colour", "SEQUENCE PLAY LOOP", &result);
+        host::advanceMillis(10000);
+        check(sequenceLength == 4 && sequencer.isPlaying(), "a looped sequence keeps its keyframes");
+
+        host::callFunction("colour", "SET 100 0 0", &result);
+        host::advanceMillis(10000);
+        check(!sequencer.isPlaying() && lamp.getColour().r == 100 && lamp.getRestoreColour().r == 100, "SET during a SEQUENCE PLAY stops the sequence");
+
+        host::callFunction("colour", "SEQUENCE CLEAR", &result);
+        check(sequenceLength == 0 && !sequencer.isPlaying(), "SEQUENCE CLEAR stops and empties the queue");
+
+        // An atomic frame that won't fit in the queue is refused whole: its SET is not applied either
+        for( int i = 0; i < SEQUENCE_CAPACITY; i++)
+        {
+            host::callFunction("colour", "SEQUENCE ADD 0 0 0 10 10", &result);
+        }
+        host::callFunction("colour", "@EQFvAN4ATQEFAQACAAMACgAKANQ", &result);
+        check(result == -1 && lamp.getColour().r == 100 && sequenceLength == SEQUENCE_CAPACITY, "an atomic frame is refused whole if its keyframes don't fit");
+
+        host::callFunction("colour", "SEQUENCE CLEAR", &result);
+        host::callFunction("colour", "@EQFvAN4ATQEFAQACAAMACgAKANQ", &result);
+        check(result == 2 && lamp.getColour().r == 111 && sequenceLength == 1, "an atomic frame applies SET and SEQUENCE ADD when they fit");
+        host::callFunction("colour", "SEQUENCE CLEAR", &result);
+    }
+
+    // A fade runs at a fixed frame rate to time, and pausing or retargeting it carries on from where it had got to
+    void checkFade(void)
+    {
+        int result = 0;
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::clearPwmWrites();
+
+        host::callFunction("colour", "FADE 4000 0 0 2000", &result);
+        host::advanceMillis(1000);
+        COLOUR half = lamp.getColour();
+        host::advanceMillis(1000);
+        COLOUR full = lamp.getColour();
+
+        uint32_t frames = host::pwmWriteCount();
+        printf("fade: %u PWM writes in a 2s fade\n", frames);
+        check(result == 0 && half.r == 2000 && full.r == 4000 && !colourFade.isFading(), "FADE reaches its target on time");
+        check(frames >= 2000 / FADE_TICK_MS - 1 && frames <= 2000 / FADE_TICK_MS + 1, "FADE updates at the frame rate");
+
+        // Pause half way, then fade back: the first frame of the new fade is next to where the old one stopped
+        host::callFunction("colour", "FADE 0 4000 0 1000", &result);
+        host::advanceMillis(500);
+        host::callFunction("colour", "FADE PAUSE", &result);
+        COLOUR paused = lamp.getColour();
+        host::advanceMillis(500);
+        COLOUR later = lamp.getColour();
+        check(paused.r == later.r && paused.g == later.g && paused.g == 2000, "FADE PAUSE holds the colour");
+
+        host::callFunction("colour", "FADE 0 0 0 1000", &result);
+        host::advanceMillis(FADE_TICK_MS);
+        COLOUR next = lamp.getColour();
+        check(abs((int)next.g - (int)paused.g) <= 2000 * FADE_TICK_MS / 1000 + 1, "a new FADE starts from where the last one stopped");
+
+        host::advanceMillis(1000);
+        check(lamp.getColour().g == 0 && !colourFade.isFading(), "retargeted FADE finishes");
+
+        // An explicit colour takes over: the fade neither writes over it nor changes the colour to come back to
+        host::callFunction("colour", "FADE 4000 0 0 4000", &result);
+        host::advanceMillis(1000);
+        host::callFunction("colour", "SET 100 0 0", &result);
+        host::advanceMillis(4000);
+        check(!colourFade.isFading() && lamp.getColour().r == 100 && lamp.getRestoreColour().r == 100, "SET during a FADE stops the fade");
+    }
+
+    // The pulse follows the waveform at full resolution: many more than the old 100 levels, and close to the curve
+    void checkPulse(void)
+    {
+        int result = 0;
+        bool levelSeen[4096] = { false };
+        int levels = 0;
+        int worst = 0;
+
+        lamp.setColourResolution(12);
+        host::callFunction("colour", "SET 4095 0 0", &result);
+        host::callFunction("pulse", "WAVE SINE", &result);
+        host::callFunction("pulse", "PERIOD 10", &result);
+        host::callFunction("pulse", "ON", &result);
+
+        for( int ms = 1; ms <= 10000; ms++)
+        {
+            host::advanceMillis(1);
+
+            uint32_t red = lamp.getColour().r;
+            int expected = (int)lround(4095 * (1 + cos(2 * M_PI * ms / 10000.0)) / 2);
+
+            worst = std::max(worst, abs((int)red - expected));
+            if( !levelSeen[red]) levels++;
+            levelSeen[red] = true;
+        }
+
+        host::callFunction("pulse", "OFF", &result);
+
+        // Between ticks the curve can move on by up to its steepest slope times the shortest tick
+        int allowed = (int)ceil(4095 * M_PI * PULSE_MIN_TICK_MS / 10000) + 1;
+
+        printf("pulse: %d levels in one period, worst error %d LSB (%d allowed)\n", levels, worst, allowed);
+        check(levels > 200 && worst <= allowed, "SINE pulse follows the curve at full resolution");
+        check(lamp.getColour().r == 4095, "pulse OFF restores the colour");
+
+        host::callFunction("pulse", "WAVE SQUARE", &result);
+        check(result == -1, "unknown waveforms are rejected");
+    }
+
+    // A dim colour has few levels to pulse through: the pulser should sleep between them, not tick at a fixed rate
+    void checkPulseScheduling(void)
+    {
+        int result = 0;
+        const int fixedRateTicks = 10000 / 20;
+
+        host::callFunction("colour", "SET 40 20 0", &result);
+        host::callFunction("pulse", "WAVE BREATHE", &result);
+        host::callFunction("pulse", "PERIOD 10", &result);
+        host::callFunction("pulse", "ON", &result);
+
+        int ticks = pulseTicks;
+        int changes = pulseChanges;
+        host::advanceMillis(10000);
+        ticks = pulseTicks - ticks;
+        changes = pulseChanges - changes;
+
+        host::callFunction("pulse", "OFF", &result);
+        host::callFunction("pulse", "WAVE SINE", &result);
+
+        printf("pulse: dim BREATHE took %d ticks (%d changed the output), against %d at a fixed 20ms\n", ticks, changes, fixedRateTicks);
+        check(ticks < fixedRateTicks / 2 && changes * 10 >= ticks * 9, "pulse ticks only when the output changes");
+
+        // A new period or waveform is picked up by the timer, on its own thread, within a millisecond
+        host::callFunction("colour", "SET 4095 0 0", &result);
+        host::callFunction("pulse", "PERIOD 10", &result);
+        host::callFunction("pulse", "ON", &result);
+        host::advanceMillis(100);
+        ticks = pulseTicks;
+        host::callFunction("pulse", "PERIOD 2", &result);
+        host::callFunction("pulse", "WAVE TRIANGLE", &result);
+        bool fromCommand = pulseTicks != ticks;
+        host::advanceMillis(1);
+        check(!fromCommand && pulseTicks - ticks == 1, "PERIOD and WAVE leave the tick to the timer, straight away");
+
+        host::callFunction("pulse", "OFF", &result);
+        host::callFunction("pulse", "WAVE SINE", &result);
+        host::callFunction("pulse", "PERIOD 10", &result);
+    }
+
+    // Connecting starts the greeting without holding up loop(), and a command stops it straight away
+    void checkGreeting(void)
+    {
+        int result = 0;
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::setCloudConnected(false);
+        loop();
+        host::setCloudConnected(true);
+
+        uint64_t start = host::nowMicros();
+        loop();
+        uint64_t blocked = host::nowMicros() - start;
+
+        check(blocked == 0 && greeting.isRunning(), "the greeting does not block loop()");
+
+        host::advanceMillis(2000);
+        host::callFunction("colour", "SET 5 6 7", &result);
+        host::advanceMillis(20000);
+
+        COLOUR c = lamp.getColour();
+        check(!greeting.isRunning() && c.r == 5 && c.g == 6 && c.b == 7, "a colour command cancels the greeting");
+    }
+
+    // With fast boot, a reset (setup() again, with retained memory kept) comes straight back to the last colour and level
+    void checkFastBoot(void)
+    {
+        int result = 0;
+
+        host::callFunction("admin", "FASTBOOT ON", &result);
+        host::callFunction("colour", "SET 100 200 300", &result);
+        host::callFunction("colour", "LEVEL 50", &result);
+
+        uint32_t boots = bootRecord.boots;
+        host::setCloudConnected(false);
+        loop();
+        setup();
+
+        COLOUR c = lamp.getColour();
+        check(bootRecord.boots == boots + 1 && c.r == 100 && c.g == 200 && c.b == 300 && lamp.getBrightnessLevel() == 50,
+              "fast boot restores the last colour and level in setup()");
+
+        host::setCloudConnected(true);
+        loop();
+        check(!greeting.isRunning(), "fast boot skips the greeting");
+
+        host::callFunction("colour", "SET 1 1 1", &result);
+
+        std::string report;
+        host::readVariable("boot", &report);
+        printf("boot: %s\n", report.c_str());
+        check(report.find("cloud=-") == std::string::npos && report.find("command=-") == std::string::npos, "boot milestones are recorded");
+
+        host::callFunction("admin", "FASTBOOT OFF", &result);
+        host::callFunction("colour", "LEVEL 100", &result);
+    }
+
+    // With DEBUG ON, commands write trace records rather than text: nothing reaches the serial port until loop()
+    void checkTrace(void)
+    {
+        int result = 0;
+        TraceDecoder decoder;
+
+        host::callFunction("admin", "DEBUG ON", &result);
+        loop();
+        host::clearSerialOutput();
+
+        host::callFunction("colour", "SET 10 20 30", &result);
+        host::callFunction("pulse", "PERIOD 2.5", &result);
+        host::callFunction("colour", "NONSENSE", &result);
+        check(host::serialOutput().empty(), "commands do not write to the serial port");
+
+        loop();
+        std::string text = decoder.feed(host::serialOutput());
+        host::clearSerialOutput();
+
+        check(text.find("colour command SET 10 20 30") != std::string::npos &&
+              text.find("pulse command PERIOD ? 2500") != std::string::npos &&
+              text.find("not a valid command") != std::string::npos &&
+              decoder.getBadRecords() == 0, "trace records decode back to text");
+
+        // Overfill the ring: the extra records are counted, not waited for
+        for( int i = 0; i < TRACE_CAPACITY * 2; i++)
+        {
+            host::callFunction("colour", "SET 1 2 3", &result);
+        }
+        loop();
+        loop();
+        text = decoder.feed(host::serialOutput());
+        host::clearSerialOutput();
+
+        check(text.find(" trace records dropped") != std::string::npos, "a full trace ring drops and counts records");
+
+        host::callFunction("admin", "DEBUG OFF", &result);
+        loop();
+        host::clearSerialOutput();
+    }
+
+    /*
+     * Connection
+     */
+
+    // Run loop() once a millisecond, as lamp_host does, so the listening timeout and greeting see time pass
+    void runLoopFor(uint32_t ms)
+    {
+        for( uint32_t i = 0; i < ms; i++)
+        {
+            loop();
+            host::advanceMillis(1);
+        }
+    }
+
+    bool sameColour(COLOUR c, uint32_t r, uint32_t g, uint32_t b)
+    {
+        return c.r == r && c.g == g && c.b == b;
+    }
+
+    // Script connection flaps through the stand-in's system events: reconnect attempts back off, and the time
+    // in each state and the changes between them add up
+    void checkConnection(void)
+    {
+        host::setCloudConnected(true);
+        loop();
+        check(conn.isConnected(), "connected when the cloud event comes in");
+
+        uint32_t connections = conn.getConnections();
+        uint32_t connectingChanges = conn.getStateChanges(CONNECTING);
+        uint32_t attempts = conn.getReconnectAttempts();
+        uint32_t requests = host::cloudConnectRequests();
+        uint32_t timeConnected = conn.getTimeInState(CONNECTED);
+        uint32_t timeConnecting = conn.getTimeInState(CONNECTING);
+
+        // A long dropout: attempts at 1, 2, 4 .. seconds apart, no more than RECONNECT_MAX_MS apart
+        host::setCloudConnected(false);
+        check(conn.getCloudRecoveryState() == CONNECTING, "losing the cloud is noticed straight away");
+
+        const uint32_t expected[] = { 1000, 3000, 7000, 15000, 31000, 63000, 95000 };
+        bool backoff = true;
+        uint32_t elapsed = 0;
+
+        for( uint32_t due : expected)
+        {
+            host::advanceMillis(due - 1 - elapsed);
+            uint32_t before = host::cloudConnectRequests();
+            host::advanceMillis(1);
+            elapsed = due;
+
+            backoff = backoff && host::cloudConnectRequests() == before + 1;
+        }
+        printf("connection: %lu reconnect attempts in %lu ms\n", (unsigned long)(host::cloudConnectRequests() - requests), (unsigned long)elapsed);
+        check(backoff && conn.getReconnectAttempts() - attempts == 7, "reconnect attempts back off to RECONNECT_MAX_MS");
+
+        host::advanceMillis(5000);
+        host::setCloudConnected(true);
+        check(conn.isConnected() && conn.getLastRecoveryMs() == elapsed + 5000, "recovery time is measured");
+
+        // The network dropping takes the cloud with it, and coming back is worth asking for the cloud at once
+        host::setNetworkConnected(false);
+        host::advanceMillis(300);
+        requests = host::cloudConnectRequests();
+        host::setNetworkConnected(true);
+        check(!conn.isConnected() && host::cloudConnectRequests() == requests + 1, "the network coming back asks for the cloud");
+        host::setCloudConnected(true);
+
+        // Short flaps, with loop() running: each reconnection is seen (and greeted) once
+        for( int i = 0; i < 5; i++)
+        {
+            runLoopFor(100);
+            host::setCloudConnected(false);
+            runLoopFor(250);
+            host::setCloudConnected(true);
+        }
+        runLoopFor(100);
+
+        check(conn.getConnections() - connections == 7 && conn.getStateChanges(CONNECTING) - connectingChanges == 7 &&
+              seenConnections == conn.getConnections(), "every reconnection is counted and seen by loop()");
+
+        uint32_t connectedMs = conn.getTimeInState(CONNECTED) - timeConnected;
+        uint32_t connectingMs = conn.getTimeInState(CONNECTING) - timeConnecting;
+        printf("connection: %lu ms connected, %lu ms connecting over the flaps\n", (unsigned long)connectedMs, (unsigned long)connectingMs);
+        check(connectingMs == elapsed + 5000 + 300 + 5 * 250 && connectedMs == 6 * 100, "time in each state adds up");
+
+        // Too long without the cloud: give up and listen for new credentials
+        host::setCloudConnected(false);
+        runLoopFor(LISTEN_TIMEOUT_MS + 10);
+        requests = host::cloudConnectRequests();
+        host::advanceMillis(RECONNECT_MAX_MS * 2);
+        check(conn.getCloudRecoveryState() == LISTENING && WiFi.listening() && host::cloudConnectRequests() == requests,
+              "listening after LISTEN_TIMEOUT_MS, with no more reconnect attempts");
+
+        host::setCloudConnected(true);
+        loop();
+        greeting.cancel();
+
+        conn.updateReport();
+        printf("connection: %s\n", connectionReport);
+    }
+
+    /*
+     * The LAN server, through a real socket on the loopback interface
+     */
+    const char *lanToken = "lamp-token-1";
+
+    int lanConnect(void)
+    {
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(host::tcpListenPort(LAN_PORT));
+
+        int sock = socket(AF_INET, SOCK_STREAM, 0);
+
+        if( sock >= 0 && connect(sock, (sockaddr *)&addr, sizeof(addr)) < 0)
+        {
+            close(sock);
+            sock = -1;
+        }
+
+        return sock;
+    }
+
+    std::string lanRequest(const char *method, const char *path, const char *body, const char *token = lanToken, const char *headers = "")
+    {
+        char request[512];
+
+        snprintf(request, sizeof(request), "%s %s HTTP/1.1\r\nHost: lamp\r\nAuthorization: Bearer %s\r\n%sContent-Length: %d\r\n\r\n%s",
+                 method, path, token, headers, (int)strlen(body), body);
+
+        return request;
+    }
+
+    // The complete responses in what has come back, in order
+    std::vector<std::string> lanResponses(const std::string &received)
+    {
+        std::vector<std::string> responses;
+        size_t at = 0;
+
+        for( ;; )
+        {
+            size_t end = received.find("\r\n\r\n", at);
+            if( end == std::string::npos) break;
+
+            size_t length = received.find("Content-Length: ", at);
+            if( length == std::string::npos || length > end) break;
+
+            size_t next = end + 4 + atoi(received.c_str() + length + 16);
+            if( next > received.size()) break;
+
+            responses.push_back(received.substr(at, next - at));
+            at = next;
+        }
+
+        return responses;
+    }
+
+    // Send, then run loop() until that many responses are back or the server closes the connection
+    std::vector<std::string> lanExchange(int sock, const std::string &requests, size_t expected, bool *closed = nullptr)
+    {
+        std::string received;
+        char buffer[1024];
+
+        if( closed) *closed = false;
+        if( !requests.empty()) send(sock, requests.data(), requests.size(), MSG_NOSIGNAL);
+
+        // A real socket, but on loopback: a quarter of a second is plenty
+        auto start = std::chrono::steady_clock::now();
+
+        while( lanResponses(received).size() < expected && std::chrono::steady_clock::now() - start < std::chrono::milliseconds(250))
+        {
+            loop();
+
+            ssize_t n = recv(sock, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if( n > 0) received.append(buffer, n);
+            if( n == 0)
+            {
+                if( closed) *closed = true;
+                break;
+            }
+        }
+
+        return lanResponses(received);
+    }
+
+    bool lanReturned(const std::string &response, int status, int value)
+    {
+        char expected[40];
+
+        snprintf(expected, sizeof(expected), "{\"return_value\":%d}", value);
+
+        return atoi(response.c_str() + 9) == status && (status != 200 || response.find(expected) != std::string::npos);
+    }
+
+    void checkLanServer(void)
+    {
+        int result = 0;
+
+        loop();
+        check(host::tcpListenPort(LAN_PORT) == 0, "the LAN server is off until LAN ON");
+
+        host::callFunction("admin", "LAN ON short", &result);
+        check(result == -1, "a short LAN token is refused");
+
+        host::callFunction("admin", "LAN ON lamp-token-1", &result);
+        loop();
+        check(result == 0 && host::tcpListenPort(LAN_PORT) != 0 && lanServer.isListening(), "LAN ON listens");
+
+        int sock = lanConnect();
+        check(sock >= 0, "a client connects over loopback");
+
+        // Three requests in one go, to each endpoint, one of them as the cloud API's form
+        std::string requests = lanRequest("POST", "/colour", "SET 10 20 30") + lanRequest("POST", "/pulse", "PERIOD 5") +
+                               lanRequest("POST", "/admin", "arg=DEBUG+OFF", lanToken, "Content-Type: application/x-www-form-urlencoded\r\n");
+        std::vector<std::string> responses = lanExchange(sock, requests, 3);
+        COLOUR c = lamp.getColour();
+
+        check(responses.size() == 3 && lanReturned(responses[0], 200, 0) && lanReturned(responses[1], 200, 0) && lanReturned(responses[2], 200, 0) &&
+              c.r == 10 && c.g == 20 && c.b == 30, "pipelined requests are answered in order");
+        check(responses.size() == 3 && responses[0].find("Server-Timing: lamp;dur=") != std::string::npos, "responses give the time taken");
+
+        // The same handler as the cloud function, so the same answer
+        host::callFunction("colour", "SET 1", &result);
+        responses = lanExchange(sock, lanRequest("POST", "/colour", "SET 1"), 1);
+        check(responses.size() == 1 && lanReturned(responses[0], 200, result), "a LAN command returns what the cloud function does");
+
+        responses = lanExchange(sock, lanRequest("POST", "/colour", "SET 1 1 1", "wrong-token") + lanRequest("POST", "/colour", "SET 40 50 60"), 2);
+        c = lamp.getColour();
+        check(responses.size() == 2 && lanReturned(responses[0], 401, 0) && lanReturned(responses[1], 200, 0) && c.r == 40,
+              "a bad token is refused, and the connection carries on");
+
+        responses = lanExchange(sock, lanRequest("GET", "/colour", "") + lanRequest("POST", "/nothing", "SET 1 1 1"), 2);
+        check(responses.size() == 2 && lanReturned(responses[0], 405, 0) && lanReturned(responses[1], 404, 0), "unknown methods and paths are refused");
+
+        // A request which arrives in pieces
+        std::string split = lanRequest("POST", "/colour", "SET 70 80 90");
+        responses = lanExchange(sock, split.substr(0, 30), 1);
+        bool waited = responses.empty();
+        responses = lanExchange(sock, split.substr(30), 1);
+        c = lamp.getColour();
+        check(waited && responses.size() == 1 && c.r == 70 && c.g == 80 && c.b == 90, "a request split across reads is put back together");
+
+        lanServer.updateReport();
+        check(strstr(lanReport, "connections=1 ") != nullptr, "all of that on one connection");
+
+        // Round trips on a kept alive connection, as a controller would make them
+        const int trips = 200;
+        auto start = std::chrono::steady_clock::now();
+        int answered = 0;
+
+        for( int i = 0; i < trips; i++)
+        {
+            responses = lanExchange(sock, lanRequest("POST", "/colour", i & 1 ? "SET 1 2 3" : "SET 3 2 1"), 1);
+            if( responses.size() == 1 && lanReturned(responses[0], 200, 0)) answered++;
+        }
+
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        printf("lan: %d round trips, %.1f us each, %lu us in the server for the last\n", trips, us / trips, (unsigned long)lanServer.getLastLatencyUs());
+        check(answered == trips, "every round trip is answered");
+
+        bool closed;
+        responses = lanExchange(sock, lanRequest("POST", "/colour", "SET 0 0 0", lanToken, "Connection: close\r\n"), 2, &closed);
+        check(responses.size() == 1 && responses[0].find("Connection: close") != std::string::npos && closed, "Connection: close is honoured");
+        close(sock);
+
+        // Follows the network, and LAN OFF
+        host::setNetworkConnected(false);
+        loop();
+        bool stopped = host::tcpListenPort(LAN_PORT) == 0;
+        host::setCloudConnected(true);
+        loop();
+        greeting.cancel();
+        check(stopped && host::tcpListenPort(LAN_PORT) != 0, "the LAN server stops and starts with the network");
+
+        host::callFunction("admin", "LAN OFF", &result);
+        loop();
+        check(host::tcpListenPort(LAN_PORT) == 0 && !lanServer.isListening(), "LAN OFF stops listening");
+
+        lanServer.updateReport();
+        printf("lan: %s\n", lanReport);
+    }
+
+    /*
+     * The UDP colour stream, fed by the frame generator over loopback
+     */
+    void checkStream(void)
+    {
+        int result = 0;
+        FrameGenerator generator;
+        COLOUR c;
+
+        // The colour to come back to, and a pulse for the stream to take over from
+        host::callFunction("colour", "SET 100 200 300", &result);
+        host::callFunction("pulse", "ON", &result);
+
+        host::callFunction("admin", "STREAM ON", &result);
+        loop();
+        check(result == 0 && colourStream.isListening() && host::udpListenPort(STREAM_PORT) != 0, "STREAM ON listens");
+        check(generator.open("127.0.0.1", host::udpListenPort(STREAM_PORT)), "the frame generator sends over loopback");
+
+        generator.send(millis(), 1, 2, 3);
+        loop();
+        host::advanceMillis(100);
+        c = lamp.getColour();
+        check(colourStream.isActive() && c.r == 1 && c.g == 2 && c.b == 3, "a frame sets the colour, and stops the pulse");
+
+        uint32_t sequence = generator.getSequence();
+        uint32_t dropped = colourStream.getDropped();
+        generator.send(millis(), 4, 5, 6);
+        generator.sendFrame(sequence, millis(), 7, 7, 7);
+        generator.sendFrame(sequence + 1, millis(), 8, 8, 8);
+        loop();
+        c = lamp.getColour();
+        check(colourStream.getDropped() - dropped == 2 && c.r == 4 && c.g == 5 && c.b == 6, "older and repeated frames are dropped");
+
+        uint32_t late = colourStream.getLate();
+        generator.send(millis() - STREAM_LATE_MS - 10, 9, 9, 9);
+        generator.send(millis(), 10, 11, 12);
+        loop();
+        c = lamp.getColour();
+        check(colourStream.getLate() - late == 1 && c.r == 10 && c.g == 11 && c.b == 12, "late frames are dropped");
+
+        uint8_t frame[STREAM_FRAME_BYTES];
+        uint32_t invalid = colourStream.getInvalid();
+        FrameGenerator::encode(frame, generator.getSequence() + 1, millis(), 13, 13, 13);
+        frame[STREAM_FRAME_BYTES - 1] ^= 1;
+        generator.sendBytes(frame, sizeof(frame));
+        generator.sendBytes(frame, 8);
+        loop();
+        c = lamp.getColour();
+        check(colourStream.getInvalid() - invalid == 2 && c.r == 10, "bad CRCs and short frames are refused");
+
+        uint64_t before = host::heapAllocations();
+        for( int i = 0; i < 100; i++)
+        {
+            generator.send(millis(), i, i, i);
+            loop();
+        }
+        check(host::heapAllocations() == before && lamp.getColour().r == 99, "frames are applied without allocating");
+
+        // However long it runs, the pulse it stopped isn't saved as off
+        uint32_t writes = settingsStore.getWrites();
+        for( uint32_t t = 0; t < PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS; t += 100)
+        {
+            generator.send(millis(), 99, 99, 99);
+            loop();
+            host::advanceMillis(100);
+        }
+        check(colourStream.isActive() && settingsStore.getWrites() == writes, "nothing a stream changes is saved");
+
+        host::advanceMillis(STREAM_TIMEOUT_MS + 10);
+        loop();
+        c = lamp.getColour();
+        check(!colourStream.isActive() && c.r == 100 && c.g == 200 && c.b == 300, "back to the cloud colour when the stream stops");
+        check(lightPulse.isPulsing() && sameColour(lightPulse.getPeakColour(), 100, 200, 300), "and back to the pulse it took over from");
+
+        generator.sendFrame(1, millis(), 20, 20, 20);
+        loop();
+        check(colourStream.isActive() && lamp.getColour().r == 20, "a new stream can start again from any sequence number");
+
+        // Sustained rate and latency: frames back to back, each timed from the send to its colour being written
+        typedef std::chrono::steady_clock clock;
+        const int frames = 5000;
+        std::vector<double> latencies;
+        uint32_t applied = colourStream.getApplied();
+        clock::time_point start = clock::now();
+
+        for( int i = 0; i < frames; i++)
+        {
+            clock::time_point sent = clock::now();
+            generator.send(millis(), i & 4095, (i >> 1) & 4095, (i >> 2) & 4095);
+
+            for( int spin = 0; spin < 100000 && colourStream.getApplied() - applied == (uint32_t)i; spin++) loop();
+
+            latencies.push_back(std::chrono::duration<double, std::micro>(clock::now() - sent).count());
+        }
+
+        double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        std::sort(latencies.begin(), latencies.end());
+        printf("stream: %d frames at %.0f frames a second, latency p50 %.1f us p99 %.1f us max %.1f us\n", frames, frames / elapsed,
+               latencies[frames / 2], latencies[frames * 99 / 100], latencies[frames - 1]);
+        check(colourStream.getApplied() - applied == (uint32_t)frames, "every frame of a sustained stream is applied");
+
+        host::callFunction("admin", "STREAM OFF", &result);
+        loop();
+        c = lamp.getColour();
+        check(host::udpListenPort(STREAM_PORT) == 0 && c.r == 100 && c.g == 200 && c.b == 300 && lightPulse.isPulsing(),
+              "STREAM OFF stops listening, back to the cloud colour and pulse");
+        host::callFunction("pulse", "OFF", &result);
+
+        colourStream.updateReport();
+        printf("stream: %s\n", streamReport);
+    }
+
+    /*
+     * State events: one per settled state, within the publish limit
+     */
+    std::vector<host::PublishedEvent> stateEvents(void)
+    {
+        std::vector<host::PublishedEvent> events;
+
+        for( const host::PublishedEvent &e : host::publishedEvents())
+        {
+            if( e.name == PUBLISH_EVENT) events.push_back(e);
+        }
+
+        return events;
+    }
+
+    // Replays the events through a token bucket like the cloud's: false if any would have been over the limit
+    bool withinPublishLimit(const std::vector<host::PublishedEvent> &events)
+    {
+        // In microseconds' worth of tokens, so the sums are exact
+        const uint64_t token = PUBLISH_INTERVAL_MS * 1000;
+        uint64_t credit = PUBLISH_BURST * token;
+        uint64_t last = events.empty() ? 0 : events[0].micros;
+
+        for( const host::PublishedEvent &e : events)
+        {
+            credit = std::min(credit + (e.micros - last), PUBLISH_BURST * token);
+            last = e.micros;
+
+            if( credit < token) return false;
+            credit -= token;
+        }
+
+        return true;
+    }
+
+    void checkPublisher(void)
+    {
+        int result = 0;
+
+        runLoopFor(5000);
+        host::clearPublishedEvents();
+
+        // A burst of commands, as a slider would send them: one event, for where it ends
+        for( int i = 1; i <= 20; i++)
+        {
+            char command[32];
+            snprintf(command, sizeof(command), "SET %d %d %d", i * 10, i * 20, i * 30);
+            host::callFunction("colour", command, &result);
+            runLoopFor(20);
+        }
+        host::callFunction("colour", "LEVEL 80", &result);
+        runLoopFor(2000);
+
+        std::vector<host::PublishedEvent> events = stateEvents();
+        printf("publish: %s\n", events.empty() ? "-" : events.back().data.c_str());
+        check(events.size() == 1 && events[0].data == "{\"r\":200,\"g\":400,\"b\":600,\"level\":80,\"bits\":12,\"pulse\":0}",
+              "a burst of commands is published once it settles");
+
+        // Pulsing: the colour being pulsed, not every step
+        host::clearPublishedEvents();
+        host::callFunction("pulse", "ON", &result);
+        runLoopFor(10000);
+        events = stateEvents();
+        check(events.size() == 1 && events[0].data.find("\"r\":200,") != std::string::npos && events[0].data.find("\"pulse\":1") != std::string::npos,
+              "a pulse is published once");
+        host::callFunction("pulse", "OFF", &result);
+
+        // A fade: one event, where it ends
+        runLoopFor(2000);
+        host::clearPublishedEvents();
+        host::callFunction("colour", "FADE 1000 2000 3000 3000", &result);
+        runLoopFor(5000);
+        events = stateEvents();
+        check(events.size() == 1 && events[0].data.find("\"r\":1000,\"g\":2000,\"b\":3000") != std::string::npos, "a fade is published once, when it ends");
+
+        // Settled changes faster than the limit: the bucket spaces them out, and the last one always gets out
+        host::clearPublishedEvents();
+        uint32_t changes = statePublisher.getChanges();
+        uint32_t published = statePublisher.getPublished();
+        for( int i = 0; i < 12; i++)
+        {
+            char command[32];
+            snprintf(command, sizeof(command), "SET %d 0 0", 500 + i);
+            host::callFunction("colour", command, &result);
+            runLoopFor(PUBLISH_SETTLE_MS + 10);
+        }
+        runLoopFor(PUBLISH_INTERVAL_MS * PUBLISH_BURST);
+        events = stateEvents();
+        printf("publish: %lu states, %lu events\n", (unsigned long)(statePublisher.getChanges() - changes),
+               (unsigned long)(statePublisher.getPublished() - published));
+        check(events.size() < 12 && withinPublishLimit(events) && events.back().data.find("\"r\":511,") != std::string::npos,
+              "publishes stay inside the limit, and the last state gets out");
+
+        // Subscribers hear the state again after a reconnection
+        host::clearPublishedEvents();
+        host::setCloudConnected(false);
+        runLoopFor(100);
+        host::setCloudConnected(true);
+        loop();
+        greeting.cancel();
+        runLoopFor(PUBLISH_SETTLE_MS + 100);
+        events = stateEvents();
+        check(events.size() == 1 && events[0].data.find("\"r\":511,") != std::string::npos, "the state is published again after a reconnection");
+
+        // Connected, but the cloud turns publishes down: tried again once an interval, not on every loop
+        host::clearPublishedEvents();
+        host::failPublishes(true);
+        host::callFunction("colour", "SET 600 0 0", &result);
+        runLoopFor(PUBLISH_SETTLE_MS);
+        uint32_t attempts = host::publishAttempts();
+        runLoopFor(PUBLISH_INTERVAL_MS * 5);
+        attempts = host::publishAttempts() - attempts;
+        host::failPublishes(false);
+        runLoopFor(PUBLISH_INTERVAL_MS + 10);
+        events = stateEvents();
+        printf("publish: %lu tries in %d ms while publishes fail\n", (unsigned long)attempts, PUBLISH_INTERVAL_MS * 5);
+        check(attempts >= 1 && attempts <= 6 && events.size() == 1 && events[0].data.find("\"r\":600,") != std::string::npos,
+              "a failed publish is tried again at most once every PUBLISH_INTERVAL_MS, and gets out when it can");
+
+        host::callFunction("colour", "LEVEL 100", &result);
+        runLoopFor(2000);
+    }
+
+    bool stateHas(const std::string &state, const char *field)
+    {
+        return state.find(field) != std::string::npos;
+    }
+
+    void checkState(void)
+    {
+        int result = 0;
+        std::string state;
+
+        host::callFunction("colour", "SET 100 200 300", &result);
+        host::callFunction("colour", "LEVEL 50", &result);
+        loop();
+        host::readVariable("state", &state);
+        printf("state: %s\n", state.c_str());
+        check(stateHas(state, "{\"v\":1,") && stateHas(state, "\"r\":100,\"g\":200,\"b\":300,\"level\":50,\"bits\":12,") &&
+              stateHas(state, "\"pulse\":0,\"fade\":0,\"sequence\":0,\"stream\":0,\"cloud\":0}"),
+              "the state variable holds the colour and level");
+
+        // Nothing changing: nothing rebuilt
+        uint32_t changes = stateChanges();
+        runLoopFor(3000);
+        std::string again;
+        host::readVariable("state", &again);
+        check(stateChanges() == changes && again == state, "the state variable is only rebuilt on a change");
+
+        // A pulse is one change, however many steps it takes
+        host::callFunction("pulse", "ON", &result);
+        loop();
+        changes = stateChanges();
+        runLoopFor(5000);
+        host::readVariable("state", &state);
+        check(stateChanges() == changes && stateHas(state, "\"r\":100,") && stateHas(state, "\"pulse\":1,"),
+              "a pulse is one change to the state");
+        host::callFunction("pulse", "OFF", &result);
+        runLoopFor(2000);
+
+        host::callFunction("colour", "FADE 1000 2000 3000 2000", &result);
+        loop();
+        host::readVariable("state", &state);
+        bool fading = stateHas(state, "\"fade\":1,");
+        runLoopFor(4000);
+        host::readVariable("state", &state);
+        check(fading && stateHas(state, "\"r\":1000,\"g\":2000,\"b\":3000,") && stateHas(state, "\"fade\":0,"),
+              "the state variable follows a fade");
+
+        host::setCloudConnected(false);
+        runLoopFor(100);
+        host::readVariable("state", &state);
+        bool offline = !stateHas(state, "\"cloud\":0}");
+        host::setCloudConnected(true);
+        loop();
+        greeting.cancel();
+        runLoopFor(100);
+        host::readVariable("state", &state);
+        check(offline && stateHas(state, "\"cloud\":0}"), "the state variable follows the cloud connection");
+
+        // Rebuilding does not touch the heap
+        uint64_t before = host::heapAllocations();
+        for( uint32_t i = 0; i < 100; i++)
+        {
+            lamp.setRed(i);
+            stateUpdateReport();
+        }
+        check(host::heapAllocations() == before, "rebuilding the state variable does not allocate");
+
+        host::callFunction("colour", "LEVEL 100", &result);
+        runLoopFor(2000);
+    }
+
+    /*
+     * Saved settings
+     */
+
+    // Lose the power: retained memory and the lamp's own state go, the EEPROM stays. Then boot again
+    void powerCut(void)
+    {
+        host::setCloudConnected(false);
+        loop();
+
+        bootRecord.magic = 0;
+        lightPulse.enablePulse(false);
+        lamp.setColour(0, 0, 0);
+        lamp.setRestoreColour();
+        lamp.setBrightnessLevel(100);
+        lightPulse.setPeriod(DEFAULT_PULSE_PERIOD_MS);
+        lightPulse.setWaveform(WAVE_SINE);
+
+        setup();
+    }
+
+    // Back online, and the greeting played out
+    void reconnect(void)
+    {
+        host::setCloudConnected(true);
+        loop();
+        for( int i = 0; i < 60000 && greeting.isRunning(); i++) runLoopFor(1);
+        runLoopFor(10);
+    }
+
+    // The slot holding the newest record, read straight from the EEPROM
+    int newestSlot(void)
+    {
+        int newest = -1;
+        uint32_t sequence = 0;
+
+        for( int slot = 0; slot < PERSIST_SLOTS; slot++)
+        {
+            PERSIST_RECORD record;
+            memcpy(&record, host::eepromData() + PERSIST_BASE + slot * sizeof(record), sizeof(record));
+
+            if( record.sequence != 0xFFFFFFFF && record.sequence >= sequence)
+            {
+                sequence = record.sequence;
+                newest = slot;
+            }
+        }
+
+        return newest;
+    }
+
+    void checkPersist(void)
+    {
+        int result = 0;
+
+        // Long enough for a write still waiting from the checks before, and the interval after it
+        runLoopFor(2 * PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+
+        // A burst of commands, as a slider and a dimmer would send them: one record, for where it ends
+        uint32_t changes = settingsStore.getChanges();
+        uint32_t writes = settingsStore.getWrites();
+        uint32_t bytes = host::eepromWrites();
+        for( int i = 1; i <= 20; i++)
+        {
+            char command[32];
+            snprintf(command, sizeof(command), "SET %d %d %d", i * 10, i * 20, i * 30);
+            host::callFunction("colour", command, &result);
+            host::callFunction("colour", "LEVEL DIM -1", &result);
+            runLoopFor(50);
+        }
+        runLoopFor(PERSIST_SETTLE_MS + 100);
+        printf("persist: %lu changes, %lu records, %lu bytes written\n", (unsigned long)(settingsStore.getChanges() - changes),
+               (unsigned long)(settingsStore.getWrites() - writes), (unsigned long)(host::eepromWrites() - bytes));
+        check(settingsStore.getWrites() - writes == 1 && host::eepromWrites() - bytes == sizeof(PERSIST_RECORD),
+              "a burst of commands is saved once, when it settles");
+
+        writes = settingsStore.getWrites();
+        host::callFunction("colour", "SET 200 400 600", &result);
+        runLoopFor(PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+        check(settingsStore.getWrites() == writes, "settings already saved are not written again");
+
+        host::callFunction("pulse", "PERIOD 3", &result);
+        host::callFunction("pulse", "WAVE TRIANGLE", &result);
+        host::callFunction("pulse", "ON", &result);
+        runLoopFor(PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+        check(settingsStore.getWrites() == writes + 1, "the pulse settings are saved");
+
+        // After a power cut: the colour to come back to and the level in setup(), the pulse once the greeting is done
+        writes = settingsStore.getWrites();
+        powerCut();
+        COLOUR saved = lamp.getRestoreColour();
+        bool restored = sameColour(saved, 200, 400, 600) && lamp.getBrightnessLevel() == 80 && lightPulse.getPeriod() == 3000 &&
+                        lightPulse.getWaveform() == WAVE_TRIANGLE && !lightPulse.isPulsing() && sameColour(lamp.getColour(), 0, 0, 0);
+        reconnect();
+        check(restored && lightPulse.isPulsing() && sameColour(lightPulse.getPeakColour(), 200, 400, 600),
+              "after a power cut, the colour, level and pulse come back");
+        check(settingsStore.getWrites() == writes, "coming back does not write the settings again");
+
+        // A record damaged by a power cut mid-write is passed over for the one before it
+        host::callFunction("pulse", "OFF", &result);
+        host::callFunction("colour", "SET 11 22 33", &result);
+        runLoopFor(PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+        host::callFunction("colour", "SET 44 55 66", &result);
+        runLoopFor(PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+        host::eepromData()[PERSIST_BASE + newestSlot() * sizeof(PERSIST_RECORD) + offsetof(PERSIST_RECORD, red)] ^= 0x01;
+        powerCut();
+        check(sameColour(lamp.getRestoreColour(), 11, 22, 33), "a damaged record falls back to the one before");
+        reconnect();
+
+        // Fast boot is saved too: after a power cut the colour is on the outputs before the cloud connects
+        host::callFunction("admin", "FASTBOOT ON", &result);
+        host::callFunction("colour", "SET 500 1000 1500", &result);
+        runLoopFor(PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+        uint32_t pwm[3] = { host::pwmValue(D0), host::pwmValue(D1), host::pwmValue(D2) };
+        powerCut();
+        check(bootFastEnabled() && sameColour(lamp.getColour(), 500, 1000, 1500) && host::pwmValue(D0) == pwm[0] &&
+              host::pwmValue(D1) == pwm[1] && host::pwmValue(D2) == pwm[2] && pwm[0] != 0 && !conn.isConnected(),
+              "after a power cut with fast boot, the colour shows before the cloud");
+        reconnect();
+        check(!greeting.isRunning() && sameColour(lamp.getColour(), 500, 1000, 1500), "and the greeting is still skipped");
+        host::callFunction("admin", "FASTBOOT OFF", &result);
+        runLoopFor(PERSIST_MIN_INTERVAL_MS + PERSIST_SETTLE_MS);
+
+        // Changes land in one slot after another, so every slot takes its share
+        writes = settingsStore.getWrites();
+        uint32_t before[PERSIST_SLOTS];
+        for( int slot = 0; slot < PERSIST_SLOTS; slot++)
+        {
+            before[slot] = host::eepromWrites(PERSIST_BASE + slot * sizeof(PERSIST_RECORD));
+        }
+        for( uint32_t i = 0; i < 2 * PERSIST_SLOTS; i++)
+        {
+            lamp.setRestoreColour({ i, 1, 2 });
+            settingsStore.poll();
+            host::advanceMillis(PERSIST_MIN_INTERVAL_MS);
+            settingsStore.poll();
+        }
+        uint32_t fewest = UINT32_MAX, most = 0;
+        for( int slot = 0; slot < PERSIST_SLOTS; slot++)
+        {
+            uint32_t n = host::eepromWrites(PERSIST_BASE + slot * sizeof(PERSIST_RECORD)) - before[slot];
+            fewest = std::min(fewest, n);
+            most = std::max(most, n);
+        }
+        printf("persist: %d slots written %lu to %lu times\n", PERSIST_SLOTS, (unsigned long)fewest, (unsigned long)most);
+        check(settingsStore.getWrites() - writes == 2 * PERSIST_SLOTS && most - fewest <= 1, "writes are spread over every slot");
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+        host::callFunction("colour", "LEVEL 100", &result);
+        runLoopFor(2000);
+    }
+
+    /*
+     * SoftAP pages
+     */
+
+    std::string gunzip(const std::string &gz)
+    {
+        std::string out;
+        z_stream z = {};
+        char buf[4096];
+
+        if( inflateInit2(&z, 16 + MAX_WBITS) != Z_OK) return out;
+
+        z.next_in = (Bytef *)gz.data();
+        z.avail_in = gz.size();
+
+        int status;
+        do
+        {
+            z.next_out = (Bytef *)buf;
+            z.avail_out = sizeof(buf);
+            status = inflate(&z, Z_NO_FLUSH);
+            out.append(buf, sizeof(buf) - z.avail_out);
+        } while( status == Z_OK);
+
+        inflateEnd(&z);
+
+        return status == Z_STREAM_END ? out : std::string();
+    }
+
+    std::string readFile(const std::string &path)
+    {
+        std::string data;
+        FILE *f = fopen(path.c_str(), "rb");
+        char buf[4096];
+        size_t n;
+
+        if( !f) return data;
+        while( (n = fread(buf, 1, sizeof(buf), f)) > 0) data.append(buf, n);
+        fclose(f);
+
+        return data;
+    }
+
+    // What the setup page loads: the page, with the stylesheet inline, then one script made of these in order,
+    // asked for by its ETag so a cached copy from older firmware isn't used
+    const char *setupScripts[] = { "rsa-utils/jsbn_1.js", "rsa-utils/jsbn_2.js", "rsa-utils/prng4.js", "rsa-utils/rng.js", "rsa-utils/rsa.js", "script.js" };
+    const char *setupStylesheet = "<link rel='stylesheet' type='text/css' href='style.css'>";
+
+    // The setup page comes in two requests, gzipped, in chunks, with headers that match, and unzips to its sources in softap/
+    void checkWiFiPages(void)
+    {
+        std::string softap = std::string(LAMP_SOFTAP_DIR) + "/";
+        size_t rawBytes = 0;
+        size_t sentBytes = 0;
+        bool allHeaders = true;
+        bool allChunked = true;
+
+        for( const Page &route : wifiRoutes)
+        {
+            if( !route.data) continue;
+
+            host::PageResponse response = host::fetchPage(route.url);
+            std::string length = "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+
+            sentBytes += response.body.size();
+
+            allHeaders = allHeaders && response.responseCode == 200 &&
+                         response.headers.find("Content-Encoding: gzip\r\n") != std::string::npos &&
+                         response.headers.find(length) != std::string::npos &&
+                         response.headers.find("ETag: \"") != std::string::npos &&
+                         response.headers.find("Cache-Control: ") != std::string::npos;
+            allChunked = allChunked && response.writeCalls == (route.length + WIFI_PAGE_CHUNK - 1) / WIFI_PAGE_CHUNK;
+        }
+
+        // Before, every file was its own request
+        std::string page = readFile(softap + "index.html");
+        std::string stylesheet = readFile(softap + "style.css");
+        rawBytes += page.size() + stylesheet.size();
+
+        host::PageResponse setup = host::fetchPage("/setup.js");
+        size_t etag = setup.headers.find("ETag: \"") + strlen("ETag: \"");
+        std::string versioned = "src='setup.js?v=" + setup.headers.substr(etag, setup.headers.find('"', etag) - etag) + "'";
+
+        page.replace(page.find(setupStylesheet), strlen(setupStylesheet), "<style>" + stylesheet + "</style>");
+        page.replace(page.find("src='setup.js'"), strlen("src='setup.js'"), versioned);
+        check(gunzip(host::fetchPage("/index.html").body) == page,
+              "the setup page unzips to index.html, with style.css inline and setup.js asked for by its ETag");
+
+        std::string script = gunzip(setup.body);
+        size_t at = 0;
+        bool inOrder = page.find("<script " + versioned + "></script>") != std::string::npos;
+
+        for( const char *file : setupScripts)
+        {
+            std::string source = readFile(softap + file);
+
+            at = source.empty() ? std::string::npos : script.find(source, at);
+            inOrder = inOrder && at != std::string::npos;
+            rawBytes += source.size();
+        }
+        check(inOrder, "setup.js is every script the setup page needs, in order");
+
+        printf("softap: %zu requests of %zu bytes are now 2 of %zu (%.0f%% saved)\n", 2 + sizeof(setupScripts) / sizeof(setupScripts[0]),
+               rawBytes, sentBytes, 100.0 - sentBytes * 100.0 / rawBytes);
+        check(allHeaders, "SoftAP pages have gzip, length, ETag and caching headers");
+        check(allChunked, "SoftAP pages are written in chunks");
+
+        host::PageResponse redirect = host::fetchPage("/index");
+        check(redirect.responseCode == 301 && redirect.headers == "Location: /index.html\r\n" &&
+              host::fetchPage("/nothing").responseCode == 404 && host::fetchPage("/index.htm").responseCode == 404,
+              "SoftAP redirect and not found are unchanged");
+
+        check(host::fetchPage("/setup.js?v=2").responseCode == 200 && host::fetchPage("/setup.js/").responseCode == 404,
+              "SoftAP routes ignore the query string, and only match whole paths");
+
+        host::PageResponse status = host::fetchPage("/status/boot");
+        check(status.responseCode == 200 && status.body == bootReport && host::fetchPage("/status/nothing").responseCode == 404 &&
+              host::fetchPage("/status").responseCode == 404, "SoftAP /status/ prefix route");
+    }
+
+    /*
+     * Command parsing
+     */
+
+    typedef int (*HANDLER)(String command);
+
+    typedef struct
+    {
+        HANDLER     handler;
+        const char *command;
+    } COMMAND;
+
+    const COMMAND commands[] = {
+        { LampControl,  "SET 100 200 300" },
+        { LampControl,  "set red 4000" },
+        { LampControl,  "RAMP 10 0 100" },
+        { LampControl,  "spectrum 700 0 1000" },
+        { LampControl,  "LEVEL DIM -5" },
+        { LampControl,  "LEVEL 100" },
+        { LampControl,  "PALETTE 0 5 0 10" },
+        { LampControl,  "  BALANCE 100  100 100  " },
+        { PulseLamp,    "PERIOD 0" },
+        { PulseLamp,    "off" },
+        { AdminHandler, "DEBUG OFF" },
+        { AdminHandler, "led manual" },
+    };
+
+    const int numCommands = sizeof(commands) / sizeof(commands[0]);
+
+    // The handlers parse into a fixed buffer: once the cloud has handed over the String, nothing touches the heap
+    void checkCommandAllocations(void)
+    {
+        String arguments[numCommands];
+        int result;
+
+        for( int i = 0; i < numCommands; i++) arguments[i] = commands[i].command;
+
+        uint64_t before = host::heapAllocations();
+        for( int i = 0; i < numCommands; i++)
+        {
+            result = commands[i].handler(std::move(arguments[i]));
+            keep(result);
+        }
+        uint64_t allocations = host::heapAllocations() - before;
+
+        printf("commands: %llu heap allocations in %d commands\n", (unsigned long long)allocations, numCommands);
+        check(allocations == 0, "command handlers do not allocate");
+
+        // Keywords match in any case, other words are left alone
+        host::callFunction("colour", "set 1 2 3", &result);
+        COLOUR c = lamp.getColour();
+        check(result == 0 && c.r == 1 && c.g == 2 && c.b == 3, "lower case keywords are accepted");
+
+        host::callFunction("colour", "SET PURPLE 3", &result);
+        c = lamp.getColour();
+        check(c.r == 0 && c.g == 3 && c.b == 0, "an unknown keyword is read as a number, as before");
+    }
+
+    /*
+     * Benchmarks: the paths run most, timed with host/bench/bench.h and compared against the checked-in baseline
+     */
+
+    // What the app sends most: none of these change the level or balance, so the transfer tables aren't rebuilt
+    const char *benchLampCommands[] = { "SET 100 200 300", "set red 4000", "RAMP 10 0 100", "spectrum 700 0 1000", "PALETTE 0 5 0 10" };
+    const char *benchPulseCommands[] = { "PERIOD 2.5", "WAVE BREATHE", "PERIOD 5", "WAVE SINE", "OFF" };
+    const char *benchPages[] = { "/index.html", "/setup.js", "/index", "/status/boot", "/favicon.ico", "/rsa-utils/jsbn_2.js" };
+
+    void benchResponse(void * /*cbArg*/, uint16_t /*flags*/, uint16_t responseCode, const char * /*mimeType*/, Header * /*reserved*/)
+    {
+        keep(responseCode);
+    }
+
+    void benchWrite(Writer * /*stream*/, const uint8_t * /*buf*/, size_t count)
+    {
+        keep(count);
+    }
+
+    // One round of every benchmark
+    std::vector<BENCH_RESULT> runBenchmarkRound(void)
+    {
+        std::vector<BENCH_RESULT> results;
+        int result = 0;
+        COLOUR c;
+
+        results.push_back(runBenchmark(BENCH_CALIBRATION, 10000, benchCalibration));
+
+        results.push_back(runBenchmark("colourRampFloat", 10000, [&](int i) {
+            c = referenceRamp(i & 1023, 0, 1024, 12);
+            keep(c);
+        }));
+
+        results.push_back(runBenchmark("colourRamp", 10000, [&](int i) {
+            c = lamp.colourRampFromRange(i & 1023, 0, 1024);
+            keep(c);
+        }));
+
+        results.push_back(runBenchmark("colourSpectrum", 10000, [&](int i) {
+            c = lamp.visibleColourFromRange(i & 1023, 0, 1024);
+            keep(c);
+        }));
+
+        results.push_back(runBenchmark("setColour", 10000, [&](int i) {
+            c = lamp.setColour(i & 4095, (i >> 1) & 4095, (i >> 2) & 4095);
+            keep(c);
+        }));
+
+        results.push_back(runBenchmark("setRedGreenBlue", 10000, [&](int i) {
+            lamp.setRed(i & 4095);
+            lamp.setGreen((i >> 1) & 4095);
+            lamp.setBlue((i >> 2) & 4095);
+        }));
+
+        // The pulse as the timer runs it: the cost of 10ms of virtual time, which is about one tick at this speed
+        host::callFunction("pulse", "PERIOD 1", &result);
+        host::callFunction("pulse", "ON", &result);
+        results.push_back(runBenchmark("pulseTick", 1000, [&](int) {
+            host::advanceMillis(PULSE_MIN_TICK_MS);
+        }));
+        host::callFunction("pulse", "OFF", &result);
+        host::callFunction("pulse", "PERIOD 5", &result);
+
+        // Build the String each time, as the cloud does
+        const int numLampCommands = sizeof(benchLampCommands) / sizeof(benchLampCommands[0]);
+        results.push_back(runBenchmark("lampControl", 1000, [&](int i) {
+            result = LampControl(String(benchLampCommands[i % numLampCommands]));
+            keep(result);
+        }));
+
+        const int numPulseCommands = sizeof(benchPulseCommands) / sizeof(benchPulseCommands[0]);
+        results.push_back(runBenchmark("pulseLamp", 1000, [&](int i) {
+            result = PulseLamp(String(benchPulseCommands[i % numPulseCommands]));
+            keep(result);
+        }));
+
+        const int numPages = sizeof(benchPages) / sizeof(benchPages[0]);
+        Writer writer = { benchWrite, nullptr };
+        results.push_back(runBenchmark("wifiPage", 600, [&](int i) {
+            setupWiFiPage(benchPages[i % numPages], benchResponse, nullptr, nullptr, &writer, nullptr);
+        }));
+
+        const char *rest;
+        results.push_back(runBenchmark("wifiRoute", 600, [&](int i) {
+            keep(findWifiRoute(benchPages[i % numPages], &rest));
+        }));
+
+        host::callFunction("colour", "SET 0 0 0", &result);
+
+        return results;
+    }
+
+    std::vector<BENCH_RESULT> runBenchmarks(void)
+    {
+        std::vector<BENCH_RESULT> results;
+        int cpu = benchPinCpu();
+
+        lamp.setColourResolution(12);
+
+        // Give the CPU time to clock up before the first measurement
+        for( uint64_t start = cycleCount(); cycleCount() - start < BENCH_SPIN_UP; ) keep(start);
+
+        for( int round = 0; round < BENCH_ROUNDS; round++) benchKeepFastest(&results, runBenchmarkRound());
+
+        if( cpu >= 0) printf("\nbenchmarks: fastest of %d rounds, on CPU %d\n", BENCH_ROUNDS, cpu);
+        else printf("\nbenchmarks: fastest of %d rounds, on any CPU\n", BENCH_ROUNDS);
+
+        return results;
+    }
+
+    // Print the results, and fail any benchmark whose fastest repetition is past its threshold over the baseline
+    void reportBenchmarks(const std::vector<BENCH_RESULT> &results, const char *baselinePath, bool updateBaseline)
+    {
+        std::vector<BENCH_BASELINE> baseline;
+        bool comparable = readBaseline(baselinePath, &baseline);
+        double scale = 1.0;
+
+        // Allow for this machine running faster or slower than when the baseline was recorded
+        for( const BENCH_RESULT &r : results)
+        {
+            for( const BENCH_BASELINE &b : baseline)
+            {
+                if( r.name == BENCH_CALIBRATION && b.name == BENCH_CALIBRATION) scale = r.min / b.min;
+            }
+        }
+
+        // Only min is checked: the percentiles after it are how spread out that round was
+        printf("\n%-20s %10s %10s %7s %10s %10s %10s  (%s per call)\n", "benchmark", "min", "expected", "change", "p50", "p90", "p99", CYCLE_UNITS);
+
+        for( const BENCH_RESULT &r : results)
+        {
+            const BENCH_BASELINE *b = nullptr;
+
+            for( const BENCH_BASELINE &candidate : baseline)
+            {
+                if( candidate.name == r.name) b = &candidate;
+            }
+
+            if( !b || !comparable || updateBaseline || r.name == BENCH_CALIBRATION)
+            {
+                printf("%-20s %10.1f %10s %7s %10.1f %10.1f %10.1f\n", r.name.c_str(), r.min, "-", "-", r.p50, r.p90, r.p99);
+                continue;
+            }
+
+            double expected = b->min * scale;
+            double limit = expected * (100 + b->threshold) / 100;
+            printf("%-20s %10.1f %10.1f %+6.0f%% %10.1f %10.1f %10.1f\n", r.name.c_str(), r.min, expected,
+                   (r.min - expected) * 100 / expected, r.p50, r.p90, r.p99);
+
+            if( r.min > limit)
+            {
+                char what[80];
+                snprintf(what, sizeof(what), "%s within %d%% of its baseline", r.name.c_str(), b->threshold);
+                check(false, what);
+            }
+        }
+
+        if( updateBaseline)
+        {
+            check(writeBaseline(baselinePath, results, baseline), "baseline written");
+            printf("baseline: %s\n", baselinePath);
+        }
+        else if( !comparable)
+        {
+            printf("baseline: %s missing, or in other units than %s: not compared\n", baselinePath, CYCLE_UNITS);
+        }
+        else
+        {
+            printf("baseline: scaled by %.2f for the speed of this machine\n", scale);
+        }
+    }
+
+    // What the firmware's own histograms saw over the whole run (count, p50, p99 and max, in microseconds)
+    void reportProfile(void)
+    {
+#if LAMP_PROFILE
+        profileUpdateReport();
+
+        for( const char *p = profileReport; *p; p++)
+        {
+            putchar(*p == ';' ? '\n' : *p);
+        }
+        putchar('\n');
+
+        check(profiles[PROFILE_LAMP_CONTROL].count > 0 && profiles[PROFILE_PULSE_TICK].count > 0, "profile histograms are recorded");
+#endif
+    }
+}
+
+// lamp_bench [--update-baseline] [--baseline <file>] [--no-bench]
+int main(int argc, char *argv[])
+{
+    const char *baselinePath = LAMP_BENCH_BASELINE;
+    bool updateBaseline = false;
+    bool runBench = true;
+
+    for( int i = 1; i < argc; i++)
+    {
+        if( !strcmp(argv[i], "--update-baseline")) updateBaseline = true;
+        else if( !strcmp(argv[i], "--baseline") && i + 1 < argc) baselinePath = argv[++i];
+        else if( !strcmp(argv[i], "--no-bench")) runBench = false;
+        else
+        {
+            fprintf(stderr, "usage: %s [--update-baseline] [--baseline <file>] [--no-bench]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    host::logPwmWrites(false);
+    setup();
+
+    checkColourMapping();
+    checkPalettes();
+    checkSkippedWrites();
+    checkCommandFrames();
+    checkCommandAllocations();
+    checkSequence();
+    checkFade();
+    checkPulse();
+    checkPulseScheduling();
+    checkGreeting();
+    checkFastBoot();
+    checkTrace();
+    checkWiFiPages();
+    checkConnection();
+    checkLanServer();
+    checkStream();
+    checkPublisher();
+    checkState();
+    checkPersist();
+    if( runBench) reportBenchmarks(runBenchmarks(), baselinePath, updateBaseline);
+    reportProfile();
+
+    return failures ? 1 : 0;
+}
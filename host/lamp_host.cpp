@@ -0,0 +1,190 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Runs the lamp firmware on the host stand-in, driven by a script of commands on stdin (or from a file):
+//
+//   colour|pulse|admin <args>   call the cloud function, as the Particle cloud would
+//   get <variable>              read a cloud variable
+//   advance <ms>                run the virtual clock (and loop()) forward
+//   connect | disconnect        change the cloud connection state
+//   network on|off              change the WiFi network state (off takes the cloud with it)
+//   credentials on|off          whether the device has stored WiFi credentials
+//   led <r> <g> <b>             change the on-board LED colour
+//   page <url>                  fetch a SoftAP setup page
+//   pwm                         print (and clear) the PWM writes since the last pwm command
+//   serial                      print (and clear) the USB serial output, with debug trace records decoded
+//
+// Lines starting with # are ignored
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Particle.h"
+#include "host_hal.h"
+
+#include "admin.h"
+#include "trace_decode.h"
+
+void setup(void);
+void loop(void);
+
+namespace
+{
+    TraceDecoder traceDecoder;
+
+    // The application loop runs continuously on the device: once per virtual millisecond is close enough
+    void runFor(uint32_t ms)
+    {
+        uint64_t end = host::nowMicros() + (uint64_t)ms * 1000;
+
+        while( host::nowMicros() < end)
+        {
+            loop();
+
+            if( host::nowMicros() < end) host::advanceMillis(1);
+        }
+    }
+
+    void printPwmWrites(void)
+    {
+        for( const host::PwmWrite &w : host::pwmWrites())
+        {
+            printf("%10.3f ms  pin %2u  value %5u  freq %u\n", w.micros / 1000.0, w.pin, w.value, w.frequency);
+        }
+        printf("%u PWM writes (lamp totals: %u written, %u skipped as unchanged)\n", host::pwmWriteCount(), lamp.getPwmWrites(), lamp.getSkippedPwmWrites());
+
+        host::clearPwmWrites();
+    }
+
+    bool runCommand(char *line)
+    {
+        char *command = strtok(line, " \t\r\n");
+        char *rest = strtok(nullptr, "\r\n");
+
+        if( !command || command[0] == '#') return true;
+        if( !rest) rest = (char *)"";
+
+        if( !strcmp(command, "colour") || !strcmp(command, "pulse") || !strcmp(command, "admin"))
+        {
+            int result;
+
+            if( !host::callFunction(command, rest, &result)) return false;
+            printf("%s(\"%s\") = %d\n", command, rest, result);
+        }
+        else if( !strcmp(command, "get"))
+        {
+            std::string value;
+
+            if( !host::readVariable(rest, &value)) return false;
+            printf("%s = %s\n", rest, value.c_str());
+        }
+        else if( !strcmp(command, "advance"))
+        {
+            runFor(atoi(rest));
+        }
+        else if( !strcmp(command, "connect"))
+        {
+            host::setCloudConnected(true);
+            loop();
+        }
+        else if( !strcmp(command, "disconnect"))
+        {
+            host::setCloudConnected(false);
+            loop();
+        }
+        else if( !strcmp(command, "network"))
+        {
+            host::setNetworkConnected(!strcmp(rest, "on"));
+            loop();
+        }
+        else if( !strcmp(command, "credentials"))
+        {
+            host::setWiFiCredentials(!strcmp(rest, "on"));
+        }
+        else if( !strcmp(command, "led"))
+        {
+            int r = 0, g = 0, b = 0;
+
+            sscanf(rest, "%d %d %d", &r, &g, &b);
+            host::setSystemLed(r, g, b);
+        }
+        else if( !strcmp(command, "page"))
+        {
+            host::PageResponse page = host::fetchPage(rest);
+
+            printf("%s: %u %s, %zu bytes in %zu writes\n", rest, page.responseCode, page.mimeType.c_str(), page.body.size(), page.writeCalls);
+            fputs(page.headers.c_str(), stdout);
+        }
+        else if( !strcmp(command, "pwm"))
+        {
+            printPwmWrites();
+        }
+        else if( !strcmp(command, "serial"))
+        {
+            fputs(traceDecoder.feed(host::serialOutput()).c_str(), stdout);
+            host::clearSerialOutput();
+        }
+        else
+        {
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *script = stdin;
+    char line[256];
+    int lineNumber = 0;
+
+    if( argc > 1 && !(script = fopen(argv[1], "r")))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    setup();
+    loop();
+
+    while( fgets(line, sizeof(line), script))
+    {
+        lineNumber++;
+
+        if( !runCommand(line))
+        {
+            fprintf(stderr, "line %d: not understood\n", lineNumber);
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,375 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef particle_h
+#define particle_h
+
+// Header-compatible stand-in for the parts of the Particle device OS that the lamp uses.
+// Hardware side effects are recorded rather than performed: see host_hal.h for the controls.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#include <functional>
+
+#include "spark_wiring_string.h"
+
+// Particle preprocessor macros. STARTUP() code runs during static initialisation, as on the device
+#define SYSTEM_THREAD(x)
+#define SYSTEM_MODE(x)
+#define retained
+
+// The host is single threaded: nothing to hold off
+#define ATOMIC_BLOCK() for( bool host_atomic_once = true; host_atomic_once; host_atomic_once = false)
+
+#define HOST_CONCAT_(a, b) a##b
+#define HOST_CONCAT(a, b)  HOST_CONCAT_(a, b)
+#define STARTUP(code) \
+    static struct HOST_CONCAT(host_startup_, __LINE__) { HOST_CONCAT(host_startup_, __LINE__)() { code; } } HOST_CONCAT(host_startup_instance_, __LINE__)
+
+typedef uint16_t pin_t;
+typedef uint32_t system_tick_t;
+
+typedef enum
+{
+    INPUT,
+    OUTPUT,
+    INPUT_PULLUP,
+    INPUT_PULLDOWN
+} PinMode;
+
+// Photon pin numbering
+const pin_t D0 = 0;
+const pin_t D1 = 1;
+const pin_t D2 = 2;
+const pin_t D3 = 3;
+const pin_t D4 = 4;
+const pin_t D5 = 5;
+const pin_t D6 = 6;
+const pin_t D7 = 7;
+const pin_t A0 = 10;
+const pin_t A1 = 11;
+const pin_t A2 = 12;
+const pin_t A3 = 13;
+const pin_t A4 = 14;
+const pin_t A5 = 15;
+const pin_t DAC = 16;
+const pin_t WKP = 17;
+const pin_t RX = 18;
+const pin_t TX = 19;
+
+#define TOTAL_PINS 20
+
+// GPIO / PWM
+void     pinMode(pin_t pin, PinMode mode);
+void     analogWrite(pin_t pin, uint32_t value);
+void     analogWrite(pin_t pin, uint32_t value, uint32_t pwm_frequency);
+void     analogWriteResolution(pin_t pin, uint8_t resolution);
+uint8_t  analogWriteResolution(pin_t pin);
+uint32_t analogWriteMaxFrequency(pin_t pin);
+
+// Time: a virtual clock, advanced by delay() or by the host driver
+system_tick_t millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Software timers, fired from the virtual clock rather than the timer thread
+class Timer
+{
+    public:
+        typedef std::function<void(void)> timer_callback_fn;
+
+        Timer(unsigned period, timer_callback_fn callback, bool one_shot = false);
+
+        template <typename T>
+        Timer(unsigned period, void (T::*handler)(), T& instance, bool one_shot = false)
+            : Timer(period, std::bind(handler, &instance), one_shot)
+        {
+        }
+
+        ~Timer();
+
+        bool start(unsigned block = 0);
+        bool stop(unsigned block = 0);
+        bool reset(unsigned block = 0);
+        bool changePeriod(unsigned period, unsigned block = 0);
+        bool isActive(void);
+        void dispose(void);
+
+        // Host only: run the callback, and when it is next due
+        void fire(void);
+        uint64_t dueMicros(void) const { return due; }
+
+    private:
+        timer_callback_fn callback;
+        unsigned period;
+        bool oneShot;
+        bool active;
+        uint64_t due;
+};
+
+// USB serial
+class USBSerial
+{
+    public:
+        void begin(long speed = 9600);
+        void end(void);
+        bool isConnected(void);
+
+        int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+        size_t print(const char *s);
+        size_t print(const String &s) { return print(s.c_str()); }
+        size_t print(int value);
+        size_t println(const char *s = "");
+        size_t println(const String &s) { return println(s.c_str()); }
+        size_t println(int value);
+        size_t write(uint8_t c);
+        size_t write(const uint8_t *buffer, size_t size);
+        int availableForWrite(void) { return 64; }
+};
+
+extern USBSerial Serial;
+
+// Cloud
+typedef int (*user_function_int_str_t)(String);
+
+typedef enum
+{
+    PUBLIC,
+    PRIVATE
+} Spark_Event_TypeDef;
+
+class CloudClass
+{
+    public:
+        bool function(const char *funcKey, user_function_int_str_t func);
+        bool variable(const char *varKey, const int &var);
+        bool variable(const char *varKey, const double &var);
+        bool variable(const char *varKey, const String &var);
+        bool variable(const char *varKey, const char *var);
+
+        bool publish(const char *eventName, const char *eventData = nullptr, int ttl = 60, Spark_Event_TypeDef eventType = PUBLIC);
+        bool publish(const char *eventName, const String &eventData, int ttl = 60, Spark_Event_TypeDef eventType = PUBLIC)
+        {
+            return publish(eventName, eventData.c_str(), ttl, eventType);
+        }
+
+        bool connected(void);
+        void connect(void);
+        void disconnect(void);
+        void process(void);
+};
+
+extern CloudClass Particle;
+
+// WiFi
+#define WLAN_SEC_UNSEC  0
+#define WLAN_SEC_WEP    1
+#define WLAN_SEC_WPA    2
+#define WLAN_SEC_WPA2   3
+
+#define WLAN_CIPHER_NOT_SET  0
+#define WLAN_CIPHER_AES      1
+#define WLAN_CIPHER_TKIP     2
+#define WLAN_CIPHER_AES_TKIP 3
+
+typedef struct
+{
+    char ssid[33];
+    uint8_t ssidLength;
+    uint8_t bssid[6];
+    int security;
+    int cipher;
+    uint8_t channel;
+    int maxDataRate;
+    int rssi;
+} WiFiAccessPoint;
+
+class WiFiClass
+{
+    public:
+        bool hasCredentials(void);
+        bool clearCredentials(void);
+        bool setCredentials(const char *ssid);
+        bool setCredentials(const char *ssid, const char *password);
+        bool setCredentials(const char *ssid, const char *password, unsigned long security, unsigned long cipher = WLAN_CIPHER_NOT_SET);
+        int  getCredentials(WiFiAccessPoint *results, size_t result_count);
+
+        void connect(void);
+        void disconnect(void);
+        bool connecting(void);
+        bool ready(void);
+        void listen(bool begin = true);
+        bool listening(void);
+        const char *SSID(void);
+};
+
+extern WiFiClass WiFi;
+
+// TCP. On the host these are real non-blocking sockets, on the loopback interface only: each server
+// listens on a port of its own choosing, which host::tcpListenPort() gives
+class TCPClient
+{
+    public:
+        TCPClient() : sock(-1) {}
+        explicit TCPClient(int sock) : sock(sock) {}
+
+        uint8_t connected(void);
+        int     available(void);
+        int     read(void);
+        int     read(uint8_t *buffer, size_t size);
+        size_t  write(const uint8_t *buffer, size_t size);
+        void    flush(void) {}
+        void    stop(void);
+
+        operator bool() { return connected(); }
+
+    private:
+        int sock;
+};
+
+class TCPServer
+{
+    public:
+        TCPServer(uint16_t port) : port(port), sock(-1) {}
+
+        bool begin(void);
+        TCPClient available(void);          // A newly accepted client, or one which is not connected
+        void stop(void);
+
+    private:
+        uint16_t port;
+        int sock;
+};
+
+// UDP, as real sockets on loopback like TCP: host::udpListenPort() gives the port
+class UDP
+{
+    public:
+        UDP() : port(0), sock(-1) {}
+
+        uint8_t begin(uint16_t port);
+        void    stop(void);
+        int     receivePacket(uint8_t *buffer, size_t size);    // One datagram, or 0 if none is waiting
+
+    private:
+        uint16_t port;
+        int sock;
+};
+
+// The on-board RGB LED
+class RGBClass
+{
+    public:
+        void control(bool override);
+        bool controlled(void);
+        void color(int red, int green, int blue);
+        void brightness(uint8_t brightness, bool update = true);
+        void onChange(void (*handler)(uint8_t, uint8_t, uint8_t));
+};
+
+extern RGBClass RGB;
+
+// EEPROM, as the Photon's: 2047 bytes, reading 0xFF until written. On the host it lasts over host::reset(),
+// as the device's flash lasts over a power cut, and every byte written is counted (see host_hal.h)
+#define HOST_EEPROM_LENGTH 2047
+
+class EEPROMClass
+{
+    public:
+        uint8_t read(int index);
+        void    write(int index, uint8_t value);
+        size_t  length(void) { return HOST_EEPROM_LENGTH; }
+        void    clear(void);
+
+        template <typename T>
+        T &get(int index, T &t)
+        {
+            uint8_t *p = (uint8_t *)&t;
+            for( size_t i = 0; i < sizeof(T); i++) p[i] = read(index + i);
+            return t;
+        }
+
+        template <typename T>
+        const T &put(int index, const T &t)
+        {
+            const uint8_t *p = (const uint8_t *)&t;
+            for( size_t i = 0; i < sizeof(T); i++) write(index + i, p[i]);
+            return t;
+        }
+};
+
+extern EEPROMClass EEPROM;
+
+// System
+typedef enum
+{
+    FEATURE_RETAINED_MEMORY = 1
+} HAL_Feature;
+
+// System events: the ones the lamp listens for, with their parameters
+typedef uint64_t system_event_t;
+
+#define network_status  ((system_event_t)1 << 5)
+#define cloud_status    ((system_event_t)1 << 6)
+
+enum
+{
+    network_status_disconnected = 0,
+    network_status_connecting = 1,
+    network_status_connected = 2
+};
+
+enum
+{
+    cloud_status_disconnected = 0,
+    cloud_status_connecting = 1,
+    cloud_status_connected = 2
+};
+
+class SystemClass
+{
+    public:
+        bool enableFeature(HAL_Feature /*feature*/) { return true; }
+        bool on(system_event_t events, void (*handler)(system_event_t, int));
+
+        // The Photon's DWT cycle counter: on the host, nanoseconds of real time
+        uint32_t ticks(void);
+        uint32_t ticksPerMicrosecond(void) { return 1000; }
+        String deviceID(void);
+        void reset(void);
+};
+
+extern SystemClass System;
+
+#endif
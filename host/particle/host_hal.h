@@ -0,0 +1,129 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef host_hal_h
+#define host_hal_h
+
+// Controls for the host stand-in: drive the virtual clock and the cloud, and inspect what the firmware did.
+// Nothing in src/ should include this: it is for the host driver and benchmarks only.
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "Particle.h"
+#include "softap_http.h"
+
+namespace host
+{
+    struct PwmWrite
+    {
+        uint64_t micros;
+        pin_t    pin;
+        uint32_t value;
+        uint32_t frequency;
+    };
+
+    struct PublishedEvent
+    {
+        uint64_t    micros;
+        std::string name;
+        std::string data;
+    };
+
+    struct PageResponse
+    {
+        uint16_t    responseCode;
+        std::string mimeType;
+        std::string headers;
+        std::string body;
+        size_t      writeCalls;
+    };
+
+    // Put everything back to power-on state (registered timers are kept, but stopped)
+    void reset(void);
+
+    // Virtual clock: advancing it fires any software timers which fall due, in order
+    uint64_t nowMicros(void);
+    void     advanceMicros(uint64_t us);
+    void     advanceMillis(uint32_t ms);
+
+    // PWM: every analogWrite() is counted, and logged unless logging is turned off (for benchmarks)
+    void     logPwmWrites(bool enabled);
+    const std::vector<PwmWrite> &pwmWrites(void);
+    void     clearPwmWrites(void);
+    uint32_t pwmWriteCount(void);
+    uint32_t pwmValue(pin_t pin);
+    uint8_t  pwmResolution(pin_t pin);
+
+    // Serial output is captured, and optionally echoed to stdout
+    void        echoSerial(bool enabled);
+    const std::string &serialOutput(void);
+    void        clearSerialOutput(void);
+
+    // Cloud side: what the Particle cloud would do to the device. Changes raise the system events, as on the device:
+    // losing the network loses the cloud too
+    void setCloudConnected(bool connected);
+    void setNetworkConnected(bool connected);
+    uint32_t cloudConnectRequests(void);
+    void setWiFiCredentials(bool present);
+    bool callFunction(const char *name, const char *arg, int *result);
+    bool readVariable(const char *name, std::string *value);
+    const std::vector<PublishedEvent> &publishedEvents(void);
+    void clearPublishedEvents(void);
+    // Publishes fail while set (as when the cloud is rate limiting us), connected or not; every call is counted
+    void failPublishes(bool fail);
+    uint32_t publishAttempts(void);
+
+    // TCP: the loopback port a TCPServer for the given device port is listening on, or 0 if it is not
+    uint16_t tcpListenPort(uint16_t port);
+
+    // UDP: the same, for a UDP socket
+    uint16_t udpListenPort(uint16_t port);
+
+    // The system LED, as mirrored by RGB.onChange()
+    void setSystemLed(uint8_t r, uint8_t g, uint8_t b);
+
+    // EEPROM: kept over reset(). Byte writes are counted, in all and for each address; erasing sets it back to 0xFF
+    // and the counts to zero. The contents can be changed directly, to damage a record
+    uint32_t eepromWrites(void);
+    uint32_t eepromWrites(int address);
+    uint8_t *eepromData(void);
+    void     eepromErase(void);
+
+    // SoftAP: fetch a page through the registered page handler
+    PageResponse fetchPage(const char *url);
+
+    // Heap allocations so far, by operator new and by String (which uses malloc, as on the device)
+    uint64_t heapAllocations(void);
+    void     countHeapAllocation(void);
+}
+
+#endif
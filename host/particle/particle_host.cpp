@@ -0,0 +1,1062 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Particle.h"
+#include "softap_http.h"
+#include "host_hal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <new>
+
+USBSerial   Serial;
+CloudClass  Particle;
+WiFiClass   WiFi;
+RGBClass    RGB;
+SystemClass System;
+EEPROMClass EEPROM;
+
+namespace
+{
+    struct PinState
+    {
+        PinMode  mode;
+        uint8_t  resolution;
+        uint32_t value;
+    };
+
+    struct CloudVariable
+    {
+        enum { INT, DOUBLE, STRING, CHARS } type;
+        const void *address;
+    };
+
+    struct HostState
+    {
+        uint64_t now;
+
+        PinState pins[TOTAL_PINS];
+        bool     logPwm;
+        uint32_t pwmCount;
+        std::vector<host::PwmWrite> pwmLog;
+
+        bool        serialEcho;
+        std::string serialOutput;
+
+        bool cloudConnected;
+        bool networkConnected;
+        uint32_t connectRequests;
+        bool hasCredentials;
+        bool listening;
+        std::map<std::string, user_function_int_str_t> functions;
+        std::map<std::string, CloudVariable> variables;
+        std::vector<host::PublishedEvent> events;
+        bool publishFails;
+        uint32_t publishAttempts;
+
+        void (*ledHandler)(uint8_t, uint8_t, uint8_t);
+        bool ledControlled;
+
+        PageProvider *pageProvider;
+
+        // Device port -> loopback port, for each listening TCPServer. Sockets are left open over a reset
+        std::map<uint16_t, uint16_t> listenPorts;
+        std::map<uint16_t, uint16_t> udpPorts;
+
+        // Like timers, event handlers registered during setup() are kept over a reset
+        std::vector<std::pair<system_event_t, void (*)(system_event_t, int)>> eventHandlers;
+
+        HostState() : pageProvider(nullptr) { reset(); }
+
+        void reset(void)
+        {
+            now = 0;
+
+            for( PinState &p : pins)
+            {
+                p.mode = INPUT;
+                p.resolution = 8;
+                p.value = 0;
+            }
+            logPwm = true;
+            pwmCount = 0;
+            pwmLog.clear();
+
+            serialEcho = false;
+            serialOutput.clear();
+
+            cloudConnected = false;
+            networkConnected = true;
+            connectRequests = 0;
+            hasCredentials = true;
+            listening = false;
+            functions.clear();
+            variables.clear();
+            events.clear();
+            publishFails = false;
+            publishAttempts = 0;
+
+            ledHandler = nullptr;
+            ledControlled = false;
+        }
+    };
+
+    // Function statics, so that global Timers and STARTUP() code in the firmware can use them during static init
+    HostState &state(void)
+    {
+        static HostState s;
+        return s;
+    }
+
+    std::vector<Timer *> &timers(void)
+    {
+        static std::vector<Timer *> t;
+        return t;
+    }
+
+    // Not part of HostState: the EEPROM lasts over host::reset()
+    struct HostEeprom
+    {
+        uint8_t  data[HOST_EEPROM_LENGTH];
+        uint32_t writes[HOST_EEPROM_LENGTH];
+        uint32_t totalWrites;
+
+        HostEeprom() { erase(); }
+
+        void erase(void)
+        {
+            memset(data, 0xFF, sizeof(data));
+            memset(writes, 0, sizeof(writes));
+            totalWrites = 0;
+        }
+    };
+
+    HostEeprom &eeprom(void)
+    {
+        static HostEeprom e;
+        return e;
+    }
+
+    PinState *pinState(pin_t pin)
+    {
+        static PinState unused;
+        return pin < TOTAL_PINS ? &state().pins[pin] : &unused;
+    }
+
+    void serialWrite(const char *s, size_t length)
+    {
+        state().serialOutput.append(s, length);
+
+        if( state().serialEcho)
+        {
+            fwrite(s, 1, length, stdout);
+        }
+    }
+}
+
+// GPIO / PWM
+
+void pinMode(pin_t pin, PinMode mode)
+{
+    pinState(pin)->mode = mode;
+}
+
+void analogWrite(pin_t pin, uint32_t value)
+{
+    analogWrite(pin, value, analogWriteMaxFrequency(pin) / 2);
+}
+
+void analogWrite(pin_t pin, uint32_t value, uint32_t pwm_frequency)
+{
+    PinState *p = pinState(pin);
+    uint32_t maxValue = (1u << p->resolution) - 1;
+
+    // The device clamps to the PWM range too
+    p->value = value > maxValue ? maxValue : value;
+
+    state().pwmCount++;
+    if( state().logPwm)
+    {
+        state().pwmLog.push_back({ state().now, pin, p->value, pwm_frequency });
+    }
+}
+
+void analogWriteResolution(pin_t pin, uint8_t resolution)
+{
+    if( resolution >= 2 && resolution <= 16)
+    {
+        pinState(pin)->resolution = resolution;
+    }
+}
+
+uint8_t analogWriteResolution(pin_t pin)
+{
+    return pinState(pin)->resolution;
+}
+
+// The Photon timers are clocked at 60MHz, and the counter has to fit the full resolution
+uint32_t analogWriteMaxFrequency(pin_t pin)
+{
+    return 60000000UL / (1UL << pinState(pin)->resolution);
+}
+
+// Time
+
+system_tick_t millis(void)
+{
+    return (system_tick_t)(state().now / 1000);
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)state().now;
+}
+
+void delay(unsigned long ms)
+{
+    host::advanceMillis(ms);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    host::advanceMicros(us);
+}
+
+// Timers
+
+Timer::Timer(unsigned period, timer_callback_fn callback, bool one_shot)
+    : callback(callback), period(period), oneShot(one_shot), active(false), due(0)
+{
+    timers().push_back(this);
+}
+
+Timer::~Timer()
+{
+    dispose();
+}
+
+bool Timer::start(unsigned /*block*/)
+{
+    active = true;
+    due = state().now + (uint64_t)period * 1000;
+    return true;
+}
+
+bool Timer::stop(unsigned /*block*/)
+{
+    active = false;
+    return true;
+}
+
+bool Timer::reset(unsigned block)
+{
+    return start(block);
+}
+
+// As on the device, changing the period (re)starts the timer
+bool Timer::changePeriod(unsigned newPeriod, unsigned block)
+{
+    period = newPeriod;
+    return start(block);
+}
+
+bool Timer::isActive(void)
+{
+    return active;
+}
+
+void Timer::dispose(void)
+{
+    active = false;
+    timers().erase(std::remove(timers().begin(), timers().end(), this), timers().end());
+}
+
+void Timer::fire(void)
+{
+    if( oneShot)
+    {
+        active = false;
+    }
+    else
+    {
+        // Schedule from the due time, not from now, so that the period does not drift
+        due += (uint64_t)(period ? period : 1) * 1000;
+    }
+
+    if( callback) callback();
+}
+
+// Serial
+
+void USBSerial::begin(long /*speed*/)
+{
+}
+
+void USBSerial::end(void)
+{
+}
+
+bool USBSerial::isConnected(void)
+{
+    return true;
+}
+
+int USBSerial::printf(const char *format, ...)
+{
+    char buf[256];
+    va_list args;
+
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+
+    if( n > 0) serialWrite(buf, std::min((size_t)n, sizeof(buf) - 1));
+    return n;
+}
+
+size_t USBSerial::print(const char *s)
+{
+    size_t n = strlen(s);
+    serialWrite(s, n);
+    return n;
+}
+
+size_t USBSerial::print(int value)
+{
+    return printf("%d", value);
+}
+
+size_t USBSerial::println(const char *s)
+{
+    return print(s) + print("\r\n");
+}
+
+size_t USBSerial::println(int value)
+{
+    return print(value) + print("\r\n");
+}
+
+size_t USBSerial::write(uint8_t c)
+{
+    serialWrite((const char *)&c, 1);
+    return 1;
+}
+
+size_t USBSerial::write(const uint8_t *buffer, size_t size)
+{
+    serialWrite((const char *)buffer, size);
+    return size;
+}
+
+// Cloud
+
+bool CloudClass::function(const char *funcKey, user_function_int_str_t func)
+{
+    state().functions[funcKey] = func;
+    return true;
+}
+
+bool CloudClass::variable(const char *varKey, const int &var)
+{
+    state().variables[varKey] = { CloudVariable::INT, &var };
+    return true;
+}
+
+bool CloudClass::variable(const char *varKey, const double &var)
+{
+    state().variables[varKey] = { CloudVariable::DOUBLE, &var };
+    return true;
+}
+
+bool CloudClass::variable(const char *varKey, const String &var)
+{
+    state().variables[varKey] = { CloudVariable::STRING, &var };
+    return true;
+}
+
+bool CloudClass::variable(const char *varKey, const char *var)
+{
+    state().variables[varKey] = { CloudVariable::CHARS, var };
+    return true;
+}
+
+bool CloudClass::publish(const char *eventName, const char *eventData, int /*ttl*/, Spark_Event_TypeDef /*eventType*/)
+{
+    state().publishAttempts++;
+    if( !state().cloudConnected || state().publishFails) return false;
+
+    state().events.push_back({ state().now, eventName, eventData ? eventData : "" });
+    return true;
+}
+
+bool CloudClass::connected(void)
+{
+    return state().cloudConnected;
+}
+
+void CloudClass::connect(void)
+{
+    state().connectRequests++;
+}
+
+void CloudClass::disconnect(void)
+{
+    state().cloudConnected = false;
+}
+
+void CloudClass::process(void)
+{
+}
+
+// WiFi
+
+bool WiFiClass::hasCredentials(void)
+{
+    return state().hasCredentials;
+}
+
+bool WiFiClass::clearCredentials(void)
+{
+    state().hasCredentials = false;
+    return true;
+}
+
+bool WiFiClass::setCredentials(const char *ssid)
+{
+    return setCredentials(ssid, "", WLAN_SEC_UNSEC);
+}
+
+bool WiFiClass::setCredentials(const char *ssid, const char *password)
+{
+    return setCredentials(ssid, password, WLAN_SEC_WPA2);
+}
+
+bool WiFiClass::setCredentials(const char * /*ssid*/, const char * /*password*/, unsigned long /*security*/, unsigned long /*cipher*/)
+{
+    state().hasCredentials = true;
+    return true;
+}
+
+int WiFiClass::getCredentials(WiFiAccessPoint * /*results*/, size_t /*result_count*/)
+{
+    return 0;
+}
+
+void WiFiClass::connect(void)
+{
+}
+
+void WiFiClass::disconnect(void)
+{
+}
+
+bool WiFiClass::connecting(void)
+{
+    return !state().cloudConnected && state().hasCredentials && !state().listening;
+}
+
+bool WiFiClass::ready(void)
+{
+    return state().networkConnected && !state().listening;
+}
+
+void WiFiClass::listen(bool begin)
+{
+    state().listening = begin;
+}
+
+bool WiFiClass::listening(void)
+{
+    return state().listening;
+}
+
+const char *WiFiClass::SSID(void)
+{
+    return "host";
+}
+
+// TCP
+
+uint8_t TCPClient::connected(void)
+{
+    if( sock < 0) return 0;
+    if( available() > 0) return 1;
+
+    // Still connected unless the peer has closed (a read of 0) or the socket has failed
+    char c;
+    ssize_t n = recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+
+    return n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+int TCPClient::available(void)
+{
+    int n = 0;
+
+    if( sock < 0 || ioctl(sock, FIONREAD, &n) < 0) return 0;
+
+    return n;
+}
+
+int TCPClient::read(void)
+{
+    uint8_t c;
+
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int TCPClient::read(uint8_t *buffer, size_t size)
+{
+    if( sock < 0) return -1;
+
+    ssize_t n = recv(sock, buffer, size, MSG_DONTWAIT);
+
+    return n > 0 ? (int)n : -1;
+}
+
+size_t TCPClient::write(const uint8_t *buffer, size_t size)
+{
+    if( sock < 0) return 0;
+
+    ssize_t n = send(sock, buffer, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+    return n > 0 ? (size_t)n : 0;
+}
+
+void TCPClient::stop(void)
+{
+    if( sock >= 0) close(sock);
+    sock = -1;
+}
+
+bool TCPServer::begin(void)
+{
+    if( sock >= 0) return true;
+
+    sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if( sock < 0) return false;
+
+    int on = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t length = sizeof(addr);
+
+    if( bind(sock, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(sock, 8) < 0 || getsockname(sock, (sockaddr *)&addr, &length) < 0)
+    {
+        close(sock);
+        sock = -1;
+        return false;
+    }
+
+    state().listenPorts[port] = ntohs(addr.sin_port);
+
+    return true;
+}
+
+TCPClient TCPServer::available(void)
+{
+    if( sock < 0) return TCPClient();
+
+    int client = accept4(sock, nullptr, nullptr, SOCK_NONBLOCK);
+
+    // Small writes go straight out, as they do on the device, rather than waiting on the last one's ACK
+    int on = 1;
+    if( client >= 0) setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+    return TCPClient(client);
+}
+
+void TCPServer::stop(void)
+{
+    if( sock < 0) return;
+
+    close(sock);
+    sock = -1;
+    state().listenPorts.erase(port);
+}
+
+// UDP
+
+uint8_t UDP::begin(uint16_t localPort)
+{
+    stop();
+
+    sock = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+    if( sock < 0) return 0;
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t length = sizeof(addr);
+
+    if( bind(sock, (sockaddr *)&addr, sizeof(addr)) < 0 || getsockname(sock, (sockaddr *)&addr, &length) < 0)
+    {
+        close(sock);
+        sock = -1;
+        return 0;
+    }
+
+    port = localPort;
+    state().udpPorts[port] = ntohs(addr.sin_port);
+
+    return 1;
+}
+
+void UDP::stop(void)
+{
+    if( sock < 0) return;
+
+    close(sock);
+    sock = -1;
+    state().udpPorts.erase(port);
+}
+
+int UDP::receivePacket(uint8_t *buffer, size_t size)
+{
+    if( sock < 0) return -1;
+
+    ssize_t n = recv(sock, buffer, size, MSG_DONTWAIT);
+
+    return n > 0 ? (int)n : 0;
+}
+
+// RGB LED
+
+void RGBClass::control(bool override)
+{
+    state().ledControlled = override;
+}
+
+bool RGBClass::controlled(void)
+{
+    return state().ledControlled;
+}
+
+void RGBClass::color(int /*red*/, int /*green*/, int /*blue*/)
+{
+}
+
+void RGBClass::brightness(uint8_t /*brightness*/, bool /*update*/)
+{
+}
+
+void RGBClass::onChange(void (*handler)(uint8_t, uint8_t, uint8_t))
+{
+    state().ledHandler = handler;
+}
+
+// System
+
+String SystemClass::deviceID(void)
+{
+    return String("0123456789abcdef01234567");
+}
+
+bool SystemClass::on(system_event_t events, void (*handler)(system_event_t, int))
+{
+    state().eventHandlers.push_back({ events, handler });
+    return true;
+}
+
+uint32_t SystemClass::ticks(void)
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SystemClass::reset(void)
+{
+}
+
+// EEPROM
+
+uint8_t EEPROMClass::read(int index)
+{
+    if( index < 0 || index >= HOST_EEPROM_LENGTH) return 0xFF;
+
+    return eeprom().data[index];
+}
+
+void EEPROMClass::write(int index, uint8_t value)
+{
+    if( index < 0 || index >= HOST_EEPROM_LENGTH) return;
+
+    eeprom().data[index] = value;
+    eeprom().writes[index]++;
+    eeprom().totalWrites++;
+}
+
+void EEPROMClass::clear(void)
+{
+    for( int i = 0; i < HOST_EEPROM_LENGTH; i++) write(i, 0xFF);
+}
+
+// SoftAP
+
+void softap_set_application_page_handler(PageProvider *provider, void * /*reserved*/)
+{
+    state().pageProvider = provider;
+}
+
+// Host controls
+
+namespace host
+{
+    void reset(void)
+    {
+        for( Timer *t : timers())
+        {
+            t->stop();
+        }
+        state().reset();
+    }
+
+    uint64_t nowMicros(void)
+    {
+        return state().now;
+    }
+
+    void advanceMicros(uint64_t us)
+    {
+        uint64_t target = state().now + us;
+
+        for(;;)
+        {
+            // Find the earliest timer due within this step, and fire it at its due time
+            Timer *next = nullptr;
+
+            for( Timer *t : timers())
+            {
+                if( t->isActive() && t->dueMicros() <= target && (!next || t->dueMicros() < next->dueMicros()))
+                {
+                    next = t;
+                }
+            }
+
+            if( !next) break;
+
+            if( next->dueMicros() > state().now) state().now = next->dueMicros();
+            next->fire();
+        }
+
+        state().now = target;
+    }
+
+    void advanceMillis(uint32_t ms)
+    {
+        advanceMicros((uint64_t)ms * 1000);
+    }
+
+    void logPwmWrites(bool enabled)
+    {
+        state().logPwm = enabled;
+    }
+
+    const std::vector<PwmWrite> &pwmWrites(void)
+    {
+        return state().pwmLog;
+    }
+
+    void clearPwmWrites(void)
+    {
+        state().pwmLog.clear();
+        state().pwmCount = 0;
+    }
+
+    uint32_t pwmWriteCount(void)
+    {
+        return state().pwmCount;
+    }
+
+    uint32_t pwmValue(pin_t pin)
+    {
+        return pinState(pin)->value;
+    }
+
+    uint8_t pwmResolution(pin_t pin)
+    {
+        return pinState(pin)->resolution;
+    }
+
+    void echoSerial(bool enabled)
+    {
+        state().serialEcho = enabled;
+    }
+
+    const std::string &serialOutput(void)
+    {
+        return state().serialOutput;
+    }
+
+    void clearSerialOutput(void)
+    {
+        state().serialOutput.clear();
+    }
+
+    void raiseEvent(system_event_t event, int param)
+    {
+        for( auto &h : state().eventHandlers)
+        {
+            if( h.first & event) h.second(event, param);
+        }
+    }
+
+    void setCloudConnected(bool connected)
+    {
+        if( connected && !state().networkConnected) setNetworkConnected(true);
+        if( connected == state().cloudConnected) return;
+
+        state().cloudConnected = connected;
+        if( connected) state().listening = false;
+
+        raiseEvent(cloud_status, connected ? cloud_status_connected : cloud_status_disconnected);
+    }
+
+    void setNetworkConnected(bool connected)
+    {
+        if( !connected) setCloudConnected(false);
+        if( connected == state().networkConnected) return;
+
+        state().networkConnected = connected;
+
+        raiseEvent(network_status, connected ? network_status_connected : network_status_disconnected);
+    }
+
+    uint32_t cloudConnectRequests(void)
+    {
+        return state().connectRequests;
+    }
+
+    void setWiFiCredentials(bool present)
+    {
+        state().hasCredentials = present;
+    }
+
+    bool callFunction(const char *name, const char *arg, int *result)
+    {
+        auto f = state().functions.find(name);
+
+        if( f == state().functions.end()) return false;
+
+        int r = f->second(String(arg));
+        if( result) *result = r;
+
+        return true;
+    }
+
+    bool readVariable(const char *name, std::string *value)
+    {
+        auto v = state().variables.find(name);
+
+        if( v == state().variables.end()) return false;
+
+        char buf[32];
+        const CloudVariable &var = v->second;
+
+        switch( var.type)
+        {
+            case CloudVariable::INT:
+                snprintf(buf, sizeof(buf), "%d", *(const int *)var.address);
+                *value = buf;
+                break;
+
+            case CloudVariable::DOUBLE:
+                snprintf(buf, sizeof(buf), "%f", *(const double *)var.address);
+                *value = buf;
+                break;
+
+            case CloudVariable::STRING:
+                *value = ((const String *)var.address)->c_str();
+                break;
+
+            case CloudVariable::CHARS:
+                *value = (const char *)var.address;
+                break;
+        }
+
+        return true;
+    }
+
+    const std::vector<PublishedEvent> &publishedEvents(void)
+    {
+        return state().events;
+    }
+
+    void clearPublishedEvents(void)
+    {
+        state().events.clear();
+    }
+
+    void failPublishes(bool fail)
+    {
+        state().publishFails = fail;
+    }
+
+    uint32_t publishAttempts(void)
+    {
+        return state().publishAttempts;
+    }
+
+    uint16_t tcpListenPort(uint16_t port)
+    {
+        auto p = state().listenPorts.find(port);
+
+        return p == state().listenPorts.end() ? 0 : p->second;
+    }
+
+    uint16_t udpListenPort(uint16_t port)
+    {
+        auto p = state().udpPorts.find(port);
+
+        return p == state().udpPorts.end() ? 0 : p->second;
+    }
+
+    void setSystemLed(uint8_t r, uint8_t g, uint8_t b)
+    {
+        if( state().ledHandler) state().ledHandler(r, g, b);
+    }
+
+    namespace
+    {
+        void pageResponse(void *cbArg, uint16_t /*flags*/, uint16_t responseCode, const char *mimeType, Header *header)
+        {
+            PageResponse *response = (PageResponse *)cbArg;
+
+            response->responseCode = responseCode;
+            response->mimeType = mimeType ? mimeType : "";
+            if( header) response->headers.assign(header->header_list, header->size);
+        }
+
+        void pageWrite(Writer *stream, const uint8_t *buf, size_t count)
+        {
+            PageResponse *response = (PageResponse *)stream->state;
+
+            response->body.append((const char *)buf, count);
+            response->writeCalls++;
+        }
+
+        int pageRead(Reader * /*stream*/, uint8_t * /*buf*/, size_t /*count*/)
+        {
+            return 0;
+        }
+    }
+
+    PageResponse fetchPage(const char *url)
+    {
+        PageResponse response = { 0, "", "", "", 0 };
+        Reader body = { pageRead, 0, nullptr };
+        Writer result = { pageWrite, &response };
+
+        if( state().pageProvider)
+        {
+            state().pageProvider(url, pageResponse, &response, &body, &result, nullptr);
+        }
+
+        return response;
+    }
+}
+
+namespace host
+{
+    uint32_t eepromWrites(void)
+    {
+        return eeprom().totalWrites;
+    }
+
+    uint32_t eepromWrites(int address)
+    {
+        return address >= 0 && address < HOST_EEPROM_LENGTH ? eeprom().writes[address] : 0;
+    }
+
+    uint8_t *eepromData(void)
+    {
+        return eeprom().data;
+    }
+
+    void eepromErase(void)
+    {
+        eeprom().erase();
+    }
+}
+
+namespace host
+{
+    static uint64_t allocations;
+
+    uint64_t heapAllocations(void)
+    {
+        return allocations;
+    }
+
+    void countHeapAllocation(void)
+    {
+        allocations++;
+    }
+}
+
+// Count every allocation made through new, so benchmarks can check a path does not touch the heap
+void *operator new(size_t size)
+{
+    host::countHeapAllocation();
+
+    void *p = malloc(size ? size : 1);
+    if( !p) throw std::bad_alloc();
+
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
@@ -0,0 +1,99 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef softap_http_h
+#define softap_http_h
+
+// Stand-in for the SoftAP HTTP page provider interface
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct Header
+{
+    Header(const char *headers) : size(strlen(headers)), header_list(headers) {}
+
+    size_t size;
+    const char *header_list;
+};
+
+typedef struct Reader
+{
+    typedef int (*callback_t)(struct Reader *stream, uint8_t *buf, size_t count);
+
+    callback_t callback;
+    size_t bytes_left;
+    void *state;
+
+    int read(uint8_t *buf, size_t count)
+    {
+        return callback(this, buf, count);
+    }
+
+    // Allocated with malloc(): the caller frees it
+    char *fetch_as_string()
+    {
+        char *s = (char *)malloc(bytes_left + 1);
+
+        if( s)
+        {
+            size_t length = bytes_left;
+            s[read((uint8_t *)s, length) < 0 ? 0 : length] = 0;
+        }
+        return s;
+    }
+} Reader;
+
+typedef struct Writer
+{
+    typedef void (*callback_t)(struct Writer *stream, const uint8_t *buf, size_t count);
+
+    callback_t callback;
+    void *state;
+
+    void write(const uint8_t *buf, size_t count)
+    {
+        callback(this, buf, count);
+    }
+
+    void write(const char *s)
+    {
+        write((const uint8_t *)s, strlen(s));
+    }
+} Writer;
+
+typedef void (ResponseCallback)(void *cbArg, uint16_t flags, uint16_t responseCode, const char *mimeType, Header *reserved1);
+
+typedef void (PageProvider)(const char *url, ResponseCallback *cb, void *cbArg, Reader *body, Writer *result, void *reserved);
+
+void softap_set_application_page_handler(PageProvider *provider, void *reserved);
+
+#endif
@@ -0,0 +1,329 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "spark_wiring_string.h"
+#include "host_hal.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+String::String(const char *cstr) : buffer(nullptr), len(0)
+{
+    copy(cstr ? cstr : "", cstr ? strlen(cstr) : 0);
+}
+
+String::String(const char *cstr, unsigned int length) : buffer(nullptr), len(0)
+{
+    copy(cstr, length);
+}
+
+String::String(const String &str) : buffer(nullptr), len(0)
+{
+    copy(str.buffer, str.len);
+}
+
+String::String(String &&str) : buffer(str.buffer), len(str.len)
+{
+    str.buffer = nullptr;
+    str.len = 0;
+}
+
+String::String(char c) : buffer(nullptr), len(0)
+{
+    copy(&c, 1);
+}
+
+String::String(int value, unsigned char base) : String((long)value, base)
+{
+}
+
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base)
+{
+}
+
+String::String(long value, unsigned char base) : buffer(nullptr), len(0)
+{
+    char buf[24];
+
+    if( base != 10)
+    {
+        // Wiring only signs base 10 numbers
+        *this = String((unsigned long)value, base);
+        return;
+    }
+
+    snprintf(buf, sizeof(buf), "%ld", value);
+    copy(buf, strlen(buf));
+}
+
+String::String(unsigned long value, unsigned char base) : buffer(nullptr), len(0)
+{
+    char buf[34];
+    char *p = &buf[sizeof(buf) - 1];
+
+    if( base < 2) base = 10;
+
+    *p = '\0';
+    do
+    {
+        int digit = value % base;
+        *--p = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        value /= base;
+    } while( value);
+
+    copy(p, strlen(p));
+}
+
+String::String(float value, int decimalPlaces) : String((double)value, decimalPlaces)
+{
+}
+
+String::String(double value, int decimalPlaces) : buffer(nullptr), len(0)
+{
+    char buf[48];
+
+    snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+    copy(buf, strlen(buf));
+}
+
+String::~String()
+{
+    free(buffer);
+}
+
+String & String::operator = (const String &rhs)
+{
+    if( this != &rhs) copy(rhs.buffer, rhs.len);
+    return *this;
+}
+
+String & String::operator = (const char *cstr)
+{
+    copy(cstr ? cstr : "", cstr ? strlen(cstr) : 0);
+    return *this;
+}
+
+void String::copy(const char *cstr, unsigned int length)
+{
+    char *newBuffer = (char *)malloc(length + 1);
+    host::countHeapAllocation();
+
+    memcpy(newBuffer, cstr, length);
+    newBuffer[length] = '\0';
+
+    free(buffer);
+    buffer = newBuffer;
+    len = length;
+}
+
+unsigned char String::concat(const String &str)
+{
+    return concat(str.buffer);
+}
+
+unsigned char String::concat(const char *cstr)
+{
+    if( !cstr) return 0;
+
+    unsigned int extra = strlen(cstr);
+    char *newBuffer = (char *)malloc(len + extra + 1);
+    host::countHeapAllocation();
+
+    memcpy(newBuffer, buffer, len);
+    memcpy(newBuffer + len, cstr, extra + 1);
+
+    free(buffer);
+    buffer = newBuffer;
+    len += extra;
+
+    return 1;
+}
+
+unsigned char String::concat(char c)
+{
+    char buf[2] = { c, '\0' };
+    return concat(buf);
+}
+
+unsigned char String::concat(int num)
+{
+    return concat(String(num));
+}
+
+String operator + (const String &lhs, const String &rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+String operator + (const String &lhs, const char *cstr)
+{
+    String result(lhs);
+    result.concat(cstr);
+    return result;
+}
+
+unsigned char String::equals(const String &s) const
+{
+    return len == s.len && strcmp(buffer, s.buffer) == 0;
+}
+
+unsigned char String::equals(const char *cstr) const
+{
+    return strcmp(buffer, cstr ? cstr : "") == 0;
+}
+
+unsigned char String::equalsIgnoreCase(const String &s) const
+{
+    return len == s.len && strcasecmp(buffer, s.buffer) == 0;
+}
+
+unsigned char String::startsWith(const String &prefix) const
+{
+    return prefix.len <= len && strncmp(buffer, prefix.buffer, prefix.len) == 0;
+}
+
+unsigned char String::endsWith(const String &suffix) const
+{
+    return suffix.len <= len && strcmp(buffer + len - suffix.len, suffix.buffer) == 0;
+}
+
+char String::charAt(unsigned int index) const
+{
+    return index < len ? buffer[index] : 0;
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const
+{
+    if( !bufsize || !buf) return;
+
+    if( index >= len)
+    {
+        buf[0] = '\0';
+        return;
+    }
+
+    unsigned int n = len - index;
+    if( n > bufsize - 1) n = bufsize - 1;
+
+    memcpy(buf, buffer + index, n);
+    buf[n] = '\0';
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const
+{
+    if( fromIndex >= len) return -1;
+
+    const char *found = strchr(buffer + fromIndex, ch);
+    return found ? found - buffer : -1;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const
+{
+    if( fromIndex >= len) return -1;
+
+    const char *found = strstr(buffer + fromIndex, str.buffer);
+    return found ? found - buffer : -1;
+}
+
+String String::substring(unsigned int beginIndex) const
+{
+    return substring(beginIndex, len);
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+    if( beginIndex > endIndex)
+    {
+        unsigned int temp = endIndex;
+        endIndex = beginIndex;
+        beginIndex = temp;
+    }
+
+    if( beginIndex > len) return String();
+    if( endIndex > len) endIndex = len;
+
+    return String(buffer + beginIndex, endIndex - beginIndex);
+}
+
+String & String::remove(unsigned int index)
+{
+    return remove(index, (unsigned int)-1);
+}
+
+String & String::remove(unsigned int index, unsigned int count)
+{
+    if( index >= len) return *this;
+    if( count > len - index) count = len - index;
+
+    memmove(buffer + index, buffer + index + count, len - index - count + 1);
+    len -= count;
+
+    return *this;
+}
+
+String & String::toUpperCase(void)
+{
+    for( unsigned int i = 0; i < len; i++) buffer[i] = toupper((unsigned char)buffer[i]);
+    return *this;
+}
+
+String & String::toLowerCase(void)
+{
+    for( unsigned int i = 0; i < len; i++) buffer[i] = tolower((unsigned char)buffer[i]);
+    return *this;
+}
+
+String & String::trim(void)
+{
+    unsigned int begin = 0;
+    unsigned int end = len;
+
+    while( begin < end && isspace((unsigned char)buffer[begin])) begin++;
+    while( end > begin && isspace((unsigned char)buffer[end - 1])) end--;
+
+    memmove(buffer, buffer + begin, end - begin);
+    len = end - begin;
+    buffer[len] = '\0';
+
+    return *this;
+}
+
+long String::toInt(void) const
+{
+    return atol(buffer);
+}
+
+float String::toFloat(void) const
+{
+    return atof(buffer);
+}
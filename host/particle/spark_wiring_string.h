@@ -0,0 +1,106 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef spark_wiring_string_h
+#define spark_wiring_string_h
+
+#include <stddef.h>
+
+// The subset of the Wiring String class that the lamp code uses.
+// Like the device version, every String owns a heap buffer: keep that in mind when measuring.
+class String
+{
+    public:
+        String(const char *cstr = "");
+        String(const char *cstr, unsigned int length);
+        String(const String &str);
+        String(String &&str);
+        String(char c);
+        String(int value, unsigned char base = 10);
+        String(unsigned int value, unsigned char base = 10);
+        String(long value, unsigned char base = 10);
+        String(unsigned long value, unsigned char base = 10);
+        String(float value, int decimalPlaces = 6);
+        String(double value, int decimalPlaces = 6);
+        ~String();
+
+        String & operator = (const String &rhs);
+        String & operator = (const char *cstr);
+
+        unsigned int length(void) const { return len; }
+        const char * c_str() const { return buffer; }
+        operator const char *() const { return buffer; }
+
+        unsigned char concat(const String &str);
+        unsigned char concat(const char *cstr);
+        unsigned char concat(char c);
+        unsigned char concat(int num);
+        String & operator += (const String &rhs) { concat(rhs); return *this; }
+        String & operator += (const char *cstr) { concat(cstr); return *this; }
+        String & operator += (char c) { concat(c); return *this; }
+        String & operator += (int num) { concat(num); return *this; }
+        friend String operator + (const String &lhs, const String &rhs);
+        friend String operator + (const String &lhs, const char *cstr);
+
+        unsigned char equals(const String &s) const;
+        unsigned char equals(const char *cstr) const;
+        unsigned char equalsIgnoreCase(const String &s) const;
+        unsigned char operator == (const String &rhs) const { return equals(rhs); }
+        unsigned char operator == (const char *cstr) const { return equals(cstr); }
+        unsigned char operator != (const String &rhs) const { return !equals(rhs); }
+        unsigned char operator != (const char *cstr) const { return !equals(cstr); }
+        unsigned char startsWith(const String &prefix) const;
+        unsigned char endsWith(const String &suffix) const;
+
+        char charAt(unsigned int index) const;
+        char operator [] (unsigned int index) const { return charAt(index); }
+        void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const;
+
+        int indexOf(char ch, unsigned int fromIndex = 0) const;
+        int indexOf(const String &str, unsigned int fromIndex = 0) const;
+        String substring(unsigned int beginIndex) const;
+        String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+        String & remove(unsigned int index);
+        String & remove(unsigned int index, unsigned int count);
+        String & toUpperCase(void);
+        String & toLowerCase(void);
+        String & trim(void);
+
+        long  toInt(void) const;
+        float toFloat(void) const;
+
+    private:
+        void copy(const char *cstr, unsigned int length);
+
+        char *buffer;
+        unsigned int len;
+};
+
+#endif
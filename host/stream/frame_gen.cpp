@@ -0,0 +1,115 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "frame_gen.h"
+#include "frame.h"
+
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+FrameGenerator::FrameGenerator() : sock(-1), sequence(0)
+{
+}
+
+FrameGenerator::~FrameGenerator()
+{
+    close();
+}
+
+bool FrameGenerator::open(const char *address, uint16_t port)
+{
+    close();
+    
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    
+    if( inet_pton(AF_INET, address, &addr.sin_addr) != 1) return false;
+    
+    sock = socket(AF_INET, SOCK_DGRAM, 0);
+    
+    // Connected, so every send goes to the lamp without giving the address again
+    if( sock >= 0 && connect(sock, (sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        close();
+    }
+    
+    return sock >= 0;
+}
+
+void FrameGenerator::close(void)
+{
+    if( sock >= 0) ::close(sock);
+    sock = -1;
+}
+
+bool FrameGenerator::send(uint32_t timestamp, uint16_t red, uint16_t green, uint16_t blue)
+{
+    return sendFrame(++sequence, timestamp, red, green, blue);
+}
+
+bool FrameGenerator::sendFrame(uint32_t frameSequence, uint32_t timestamp, uint16_t red, uint16_t green, uint16_t blue)
+{
+    uint8_t frame[STREAM_FRAME_BYTES];
+    
+    encode(frame, frameSequence, timestamp, red, green, blue);
+    
+    return sendBytes(frame, sizeof(frame));
+}
+
+bool FrameGenerator::sendBytes(const uint8_t *data, size_t length)
+{
+    return sock >= 0 && ::send(sock, data, length, 0) == (ssize_t)length;
+}
+
+void FrameGenerator::encode(uint8_t *frame, uint32_t sequence, uint32_t timestamp, uint16_t red, uint16_t green, uint16_t blue)
+{
+    uint16_t colour[3] = { red, green, blue };
+    
+    frame[0] = STREAM_VERSION << 4;
+    
+    for( int i = 0; i < 4; i++)
+    {
+        frame[1 + i] = sequence >> (8 * i);
+        frame[5 + i] = timestamp >> (8 * i);
+    }
+    
+    for( int i = 0; i < 3; i++)
+    {
+        frame[9 + 2 * i] = colour[i] & 0xFF;
+        frame[10 + 2 * i] = colour[i] >> 8;
+    }
+    
+    frame[STREAM_FRAME_BYTES - 1] = frameCrc8(frame, STREAM_FRAME_BYTES - 1);
+}
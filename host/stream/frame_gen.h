@@ -0,0 +1,70 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef frame_gen_h
+#define frame_gen_h
+
+#include <stdint.h>
+
+#include "stream.h"
+
+/*
+ * Sends colour stream frames (src/stream.h) over UDP: to a lamp on the network, or to the host build's
+ * listener on loopback.
+ *
+ * Frames are numbered in order as they are sent. sendFrame() sends one with any sequence number, to try
+ * out the lamp's handling of frames which arrive out of order
+ */
+class FrameGenerator
+{
+    public:
+        FrameGenerator();
+        ~FrameGenerator();
+        
+        bool open(const char *address, uint16_t port);
+        void close(void);
+        
+        // The next frame in sequence, stamped with the sender's clock (in milliseconds)
+        bool send(uint32_t timestamp, uint16_t red, uint16_t green, uint16_t blue);
+        bool sendFrame(uint32_t sequence, uint32_t timestamp, uint16_t red, uint16_t green, uint16_t blue);
+        
+        // Send some bytes as they are, as a broken sender might
+        bool sendBytes(const uint8_t *data, size_t length);
+        
+        uint32_t getSequence(void) const { return sequence; }
+        
+        static void encode(uint8_t *frame, uint32_t sequence, uint32_t timestamp, uint16_t red, uint16_t green, uint16_t blue);
+        
+    private:
+        int sock;
+        uint32_t sequence;
+};
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+// Streams colour frames to a lamp (after admin STREAM ON), at a steady rate: a slow cycle round the colour
+// wheel, so dropped or late frames show up as jumps. For example
+//
+//   lamp_stream 192.168.1.40 60 30         60 frames a second for 30 seconds, to the default port
+//
+// lamp_stream <address> [<fps>] [<seconds>] [<bits>] [<port>]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <thread>
+
+#include "frame_gen.h"
+
+int main(int argc, char *argv[])
+{
+    if( argc < 2)
+    {
+        fprintf(stderr, "usage: %s <address> [<fps>] [<seconds>] [<bits>] [<port>]\n", argv[0]);
+        return 2;
+    }
+    
+    int fps = argc > 2 ? atoi(argv[2]) : 60;
+    int seconds = argc > 3 ? atoi(argv[3]) : 10;
+    int bits = argc > 4 ? atoi(argv[4]) : 12;
+    int port = argc > 5 ? atoi(argv[5]) : STREAM_PORT;
+    
+    if( fps < 1 || seconds < 1 || bits < 1 || bits > 16)
+    {
+        fprintf(stderr, "%s: fps and seconds must be at least 1, and bits 1 to 16\n", argv[0]);
+        return 2;
+    }
+    
+    FrameGenerator generator;
+    
+    if( !generator.open(argv[1], port))
+    {
+        fprintf(stderr, "%s: can't send to %s port %d\n", argv[0], argv[1], port);
+        return 1;
+    }
+    
+    typedef std::chrono::steady_clock clock;
+    
+    uint32_t maxColour = (1UL << bits) - 1;
+    int frames = fps * seconds;
+    int failed = 0;
+    clock::time_point start = clock::now();
+    
+    for( int i = 0; i < frames; i++)
+    {
+        // Wait for this frame's slot, so the rate holds however long the sends take
+        std::this_thread::sleep_until(start + std::chrono::microseconds((int64_t)i * 1000000 / fps));
+        
+        clock::duration now = clock::now().time_since_epoch();
+        uint32_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+        
+        // Round the colour wheel once every 6 seconds: one primary rising while the one before falls
+        uint32_t position = (uint64_t)i * maxColour / fps % (6 * maxColour);
+        uint32_t step = position % maxColour;
+        uint32_t colour[3] = { 0, 0, 0 };
+        int from = position / maxColour / 2;
+        
+        colour[from] = position / maxColour % 2 ? maxColour - step : maxColour;
+        colour[(from + 1) % 3] = position / maxColour % 2 ? maxColour : step;
+        
+        if( !generator.send(ms, colour[0], colour[1], colour[2])) failed++;
+    }
+    
+    double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    
+    printf("%d frames in %.2f s: %.1f frames a second, %d failed to send\n", frames, elapsed, frames / elapsed, failed);
+    
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+// Decodes the lamp's USB serial output, from stdin, into text: for example
+//
+//   lamp_trace < /dev/ttyACM0
+
+#include <stdio.h>
+
+#include "trace_decode.h"
+
+int main(void)
+{
+    TraceDecoder decoder;
+    char buf[256];
+    size_t n;
+    
+    while( (n = fread(buf, 1, sizeof(buf), stdin)) > 0)
+    {
+        fputs(decoder.feed(buf, n).c_str(), stdout);
+        fflush(stdout);
+    }
+    
+    if( decoder.getBadRecords())
+    {
+        fprintf(stderr, "%u bad trace records\n", decoder.getBadRecords());
+    }
+    
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+
+#include "trace_decode.h"
+#include "trace.h"
+#include "command.h"
+
+static uint32_t getUint32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+TraceDecoder::TraceDecoder() :
+    records(0),
+    badRecords(0)
+{
+}
+
+std::string TraceDecoder::feed(const char *data, size_t length)
+{
+    std::string text;
+    
+    pending.append(data, length);
+    
+    size_t i = 0;
+    while( i < pending.size())
+    {
+        if( (uint8_t)pending[i] != TRACE_SYNC)
+        {
+            text += pending[i++];
+            continue;
+        }
+        
+        // Wait for the rest of the record
+        if( pending.size() - i < 3) break;
+        
+        const uint8_t *record = (const uint8_t *)pending.data() + i;
+        uint8_t event = record[1];
+        uint8_t numArgs = record[2];
+        
+        if( numArgs > TRACE_MAX_ARGS || traceFormat(event) == nullptr)
+        {
+            // Not a record after all
+            badRecords++;
+            text += pending[i++];
+            continue;
+        }
+        
+        size_t recordLength = 1 + 2 + 4 + 4 * numArgs + 1;
+        if( pending.size() - i < recordLength) break;
+        
+        uint8_t sum = 0;
+        for( size_t b = 1; b < recordLength - 1; b++) sum += record[b];
+        
+        if( sum != record[recordLength - 1])
+        {
+            badRecords++;
+            text += pending[i++];
+            continue;
+        }
+        
+        text += format(record);
+        records++;
+        i += recordLength;
+    }
+    
+    pending.erase(0, i);
+    
+    return text;
+}
+
+std::string TraceDecoder::format(const uint8_t *record)
+{
+    const char *f = traceFormat(record[1]);
+    int numArgs = record[2];
+    int arg = 0;
+    char buf[32];
+    
+    snprintf(buf, sizeof(buf), "[%10.3f ms] ", getUint32(record + 3) / 1000.0);
+    std::string line(buf);
+    
+    for( ; *f; f++)
+    {
+        if( *f != '%' || (f[1] != 'd' && f[1] != 'k'))
+        {
+            line += *f;
+            continue;
+        }
+        
+        int32_t value = arg < numArgs ? (int32_t)getUint32(record + 7 + 4 * arg) : 0;
+        arg++;
+        
+        if( *++f == 'k')
+        {
+            line += keywordName((KEYWORD)value);
+        }
+        else
+        {
+            snprintf(buf, sizeof(buf), "%ld", (long)value);
+            line += buf;
+        }
+    }
+    
+    line += '\n';
+    
+    return line;
+}
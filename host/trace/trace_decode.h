@@ -0,0 +1,66 @@
+/*
+ * Host stand-in for the Particle firmware, so the lamp sources can be built and measured on Linux
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge,
+ * to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef trace_decode_h
+#define trace_decode_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+/*
+ * Turns the lamp's USB serial output back into text: binary trace records (src/trace.h) are formatted
+ * one per line, with their timestamp, and everything else is passed through as it is.
+ *
+ * Output can be fed in any size of piece: a record split across two feeds is held over to the next.
+ */
+class TraceDecoder
+{
+    public:
+        TraceDecoder();
+        
+        // Decode some more serial output, returning the text for it
+        std::string feed(const char *data, size_t length);
+        std::string feed(const std::string &data) { return feed(data.data(), data.size()); }
+        
+        // Records decoded, and ones thrown away for a bad checksum or an unknown event
+        unsigned int getRecords(void) const { return records; }
+        unsigned int getBadRecords(void) const { return badRecords; }
+        
+    private:
+        std::string format(const uint8_t *record);
+        
+        std::string pending;
+        unsigned int records;
+        unsigned int badRecords;
+};
+
+#endif
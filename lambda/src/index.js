@@ -490,16 +490,61 @@ function getState(request, context) {
     const deviceId = request.directive.endpoint.cookie.deviceID;
     const accessToken = request.directive.endpoint.scope.token;
     
-    // Store the results here, process when we have them all
+    // Firmware from before the state variable: ask for the colour and level one at a time instead
+    var readSeparately = function() {
+        const names = ['red', 'green', 'blue', 'level'];
+        var separateContext = {
+            particleVars: {},
+            respCallback: function(varList) {
+                var next = names[Object.keys(varList).length];
+                
+                if( next )
+                {
+                    getParticleVariable( next, request, separateContext);
+                    return;
+                }
+                
+                var stateResponse = generateStateResponse(request, varList);
+                context.succeed(stateResponse);
+            }
+        };
+        
+        getParticleVariable( names[0], request, separateContext);
+    };
+    
+    // The lamp packs its whole state into one variable, so one request gets colour and level from the same moment
     let particleVars = {}
     var respCallback = function(varList) {
-        // We only execute the callback when we have all 4 variables filled in
-        if( Object.keys(varList).length == 4 )
+        var state;
+        
+        if( varList.state === undefined )
         {
-            // OK, we have all the variables.
-            var stateResponse = generateStateResponse(request, varList);
-            context.succeed(stateResponse);
+            readSeparately();
+            return;
         }
+        
+        try {
+            state = JSON.parse(varList.state);
+        } catch (e) {
+            context.fail(e);
+            return;
+        }
+        
+        // The version only changes if fields change meaning or go away, and 1 is the one we understand:
+        // for any other, the separate variables still say what we need
+        if( state.v !== 1 )
+        {
+            readSeparately();
+            return;
+        }
+        
+        var stateResponse = generateStateResponse(request, {
+            red: state.r,
+            green: state.g,
+            blue: state.b,
+            level: state.level
+        });
+        context.succeed(stateResponse);
     };
  
     // Well this looks fugly
@@ -508,11 +553,7 @@ function getState(request, context) {
         particleVars
     }
     
-    // Ask for a few variables ... and handle them in the callback
-    getParticleVariable( 'red', request, callbackContext);
-    getParticleVariable( 'green', request, callbackContext);
-    getParticleVariable( 'blue', request, callbackContext);
-    getParticleVariable( 'level', request, callbackContext);
+    getParticleVariable( 'state', request, callbackContext);
     
 }
 /**
@@ -20,6 +20,8 @@
 import os
 import sys
 import random
+import struct
+import base64
 from argparse import ArgumentParser
 
 try:
@@ -64,6 +66,70 @@ def runRawCommand(lamp, rawCommand):
         
     return
     
+# Packed command frames: several operations in one call to the colour function (see src/frame.h)
+# Each operation is a string like the normal commands: "SET r g b", "LEVEL x", "PERIOD x", "PULSE ON|OFF"
+# "SEQUENCE ADD r g b fadeMs holdMs" or "FADE r g b ms" (times are sent in hundredths of a second)
+FRAME_MARKER = '@'
+FRAME_VERSION = 1
+FRAME_FLAG_ATOMIC = 0x01
+
+def frameCrc8(data):
+    crc = 0
+    for byte in bytearray(data):
+        crc ^= byte
+        for i in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+def packFrame(operations, atomic=True):
+    frame = struct.pack('<B', (FRAME_VERSION << 4) | (FRAME_FLAG_ATOMIC if atomic else 0))
+
+    for op in operations:
+        words = op.upper().split()
+        if words[0] == "SET":
+            frame += struct.pack('<BHHH', 0x01, int(words[1]), int(words[2]), int(words[3]))
+        elif words[0] == "LEVEL":
+            frame += struct.pack('<BB', 0x02, int(words[1]))
+        elif words[0] == "PERIOD":
+            frame += struct.pack('<BH', 0x03, int(round(float(words[1]) * 10)))
+        elif words[0] == "PULSE":
+            frame += struct.pack('<BB', 0x04, 1 if words[1] == "ON" else 0)
+        elif words[0] == "SEQUENCE" and words[1] == "ADD":
+            frame += struct.pack('<BHHHHH', 0x05, int(words[2]), int(words[3]), int(words[4]),
+                                 int(words[5]) / 10, int(words[6]) / 10)
+        elif words[0] == "FADE":
+            frame += struct.pack('<BHHHH', 0x06, int(words[1]), int(words[2]), int(words[3]), int(words[4]) / 10)
+        else:
+            raise ValueError("Can't pack operation {op}".format(op=op))
+
+    frame += struct.pack('<B', frameCrc8(frame))
+
+    packed = FRAME_MARKER + base64.b64encode(frame).rstrip('=')
+    if len(packed) > 63:
+        raise ValueError("Too many operations for one frame")
+
+    return packed
+
+# Queue a show of keyframes on the lamp, 4 to a call, and play it: the lamp does the timing, not the cloud
+# The lamp holds up to 32 keyframes
+def queueSequence(lamp, keyframes, loop=False):
+    lamp.colour("SEQUENCE CLEAR")
+
+    for i in range(0, len(keyframes), 4):
+        lamp.colour(packFrame(["SEQUENCE ADD {r} {g} {b} {f} {h}".format(r=r, g=g, b=b, f=f, h=h)
+                               for (r, g, b, f, h) in keyframes[i:i + 4]], atomic=False))
+
+    lamp.colour("SEQUENCE PLAY {mode}".format(mode="LOOP" if loop else "ONCE"))
+
+# Like runRandomColourAlgorithm, but uploaded once and looped on the lamp, with a 1s fade and 2s hold per colour
+def runRandomColourSequence(lamp):
+    keyframes = []
+
+    for i in range(32):
+        keyframes.append((random.randint(0,4095), random.randint(0,4095), random.randint(0,4095), 1000, 2000))
+
+    queueSequence(lamp, keyframes, loop=True)
+
 def runPastelColourAlgorithm(lamp):
     # Setting a colour is fairly slow (via the Spark cloud)
     # So no need for a delay in the loops here
@@ -296,6 +362,16 @@ def handleArguments():
     parser.add_argument(
         '--pulse', '-p',
         help='Fade the lamp colour in/out')
+
+    parser.add_argument(
+        '--randomshow',
+        action='store_true',
+        help='Queue a show of random colours on the lamp and loop it')
+
+    parser.add_argument(
+        '--frame',
+        nargs='+',
+        help='Send several operations in one packed command, applied together\ne.g --frame "SET 4095 0 0" "LEVEL 50" "PERIOD 2" "PULSE ON"')
         
     # Check the command line and build the argument list
     parsed_args = parser.parse_args()
@@ -333,6 +409,9 @@ def main(argv):
     if parsed_args.random:
         runRandomColourAlgorithm(lamp)
     
+    if parsed_args.randomshow:
+        runRandomColourSequence(lamp)
+
     if parsed_args.pastel:
         runPastelColourAlgorithm(lamp)
         
@@ -365,6 +444,10 @@ def main(argv):
                                                  g=parsed_args.colour[1], 
                                                  b=parsed_args.colour[2]))
            
+    # Several operations in one go
+    if parsed_args.frame is not None:
+        lamp.colour(packFrame(parsed_args.frame))
+
     # Handle a raw admin command: just send verbatim to the lamp
     # We should really make a wrapper command for 
     if parsed_args.raw is not None:
@@ -0,0 +1,176 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#############################################################################
+# softapPages
+#
+# Build step for the SoftAP setup pages: gzips everything in softap/ and writes
+# it out as src/wifi-pages.cpp, and the route table (sorted by URL, with the
+# headers each page is served with) as src/wifi-pages.h.
+#
+# The Particle build can't run this, so the output is checked in: run it again
+# (or "cmake --build build --target softap_pages") after changing anything in softap/
+#
+#################################################################################
+
+from __future__ import print_function
+
+import os
+import re
+import sys
+import zlib
+import hashlib
+
+# The static pages: URL, the files in softap/ it is made from (joined in this order), MIME type.
+# Each page is a connection through the SoftAP stack, which can't handle many at once, so the scripts are
+# served as one: and stylesheets are put inline in the HTML
+PAGES = [
+    ( "/index.html",   [ "index.html" ],                      "text/html" ),
+    ( "/setup.js",     [ "rsa-utils/jsbn_1.js",
+                         "rsa-utils/jsbn_2.js",
+                         "rsa-utils/prng4.js",
+                         "rsa-utils/rng.js",
+                         "rsa-utils/rsa.js",
+                         "script.js" ],                       "application/javascript" ),
+]
+
+# Redirects: URL, where to
+REDIRECTS = [
+    ( "/index",                "/index.html" ),
+]
+
+# Pages made by a function in the firmware (a PageHandler). A URL ending in / is a prefix:
+# it matches everything under it, and the handler is given the rest
+HANDLERS = [
+    ( "/status/",              "statusPage" ),
+]
+
+# The page itself is checked every time, so new firmware's page is picked up straight away.
+# What it loads is kept for a week: the page asks for it as ?v=<its ETag>, so new firmware's page asks for the new one
+INDEX_CACHE_CONTROL = "no-cache"
+ASSET_CACHE_CONTROL = "public, max-age=604800"
+
+def gzipBytes(data):
+    # wbits 31: a gzip wrapper, with no file name or timestamp, so the output only changes when the page does
+    compressor = zlib.compressobj(9, zlib.DEFLATED, 31)
+    return compressor.compress(data) + compressor.flush()
+
+# <link rel='stylesheet' ... href='x.css'> becomes <style> with x.css in it
+def inlineStylesheets(html, directory):
+    def replace(match):
+        with open(os.path.join(directory, match.group(1).decode("ascii")), "rb") as f:
+            return b"<style>" + f.read() + b"</style>"
+
+    return re.sub(b"<link rel='stylesheet'[^>]*href='([^']*)'[^>]*>", replace, html)
+
+# src='setup.js' becomes src='setup.js?v=<ETag>', for each page in versions (path: ETag).
+# findWifiRoute() ignores the query string, so only the browser's cache sees the difference
+def versionReferences(html, versions):
+    for path, etag in versions.items():
+        for attribute in (b"src", b"href"):
+            html = html.replace(attribute + b"='" + path.encode("ascii") + b"'",
+                                attribute + b"='" + path.encode("ascii") + b"?v=" + etag.encode("ascii") + b"'")
+    return html
+
+def pageSource(root, parts):
+    raw = b""
+    for part in parts:
+        with open(os.path.join(root, "softap", part), "rb") as f:
+            raw += (b"\n" if raw else b"") + f.read()
+    return raw
+
+def etagOf(gz):
+    return hashlib.sha1(gz).hexdigest()[:16]
+
+def arrayName(path):
+    return path.replace("/", "_").replace("-", "_").replace(".", "_") + "_gz"
+
+def cArray(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02x," % b for b in bytearray(data[i:i + 16])))
+    return "\n".join(lines)
+
+def cString(s):
+    return '"' + s.replace("\\", "\\\\").replace('"', '\\"').replace("\r", "\\r").replace("\n", "\\n") + '"'
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    source = []
+    header = []
+    routes = {}
+    rawTotal = 0
+    gzTotal = 0
+
+    source.append("// Generated by python/softapPages.py from softap/: do not edit")
+    source.append("")
+    source.append('#include "wifi-pages.h"')
+    source.append("")
+
+    # The ETags of what the pages load, first, so the pages can ask for them by version
+    versions = {}
+    for url, parts, mimeType in PAGES:
+        if mimeType != "text/html":
+            versions[url[1:]] = etagOf(gzipBytes(pageSource(root, parts)))
+
+    for url, parts, mimeType in PAGES:
+        raw = pageSource(root, parts)
+
+        path = url[1:]
+        if mimeType == "text/html":
+            raw = versionReferences(inlineStylesheets(raw, os.path.join(root, "softap")), versions)
+
+        gz = gzipBytes(raw)
+        etag = etagOf(gz)
+        cacheControl = INDEX_CACHE_CONTROL if path == "index.html" else ASSET_CACHE_CONTROL
+        headers = "Content-Encoding: gzip\r\nContent-Length: %d\r\nETag: \"%s\"\r\nCache-Control: %s\r\n" % (len(gz), etag, cacheControl)
+
+        source.append("// %s, from %s: %d bytes, %d gzipped" % (url, " ".join(parts), len(raw), len(gz)))
+        source.append("const uint8_t %s[%d] = {" % (arrayName(path), len(gz)))
+        source.append(cArray(gz))
+        source.append("};")
+        source.append("")
+
+        header.append("extern const uint8_t %s[%d];" % (arrayName(path), len(gz)))
+        routes[url] = "{ %s, 200, %s, %s, %d, %s, nullptr, false }" % (cString(url), cString(mimeType), arrayName(path), len(gz), cString(headers))
+
+        rawTotal += len(raw)
+        gzTotal += len(gz)
+
+    for url, target in REDIRECTS:
+        routes[url] = "{ %s, 301, \"text/plain\", nullptr, 0, %s, nullptr, false }" % (cString(url), cString("Location: %s\r\n" % target))
+
+    for url, handler in HANDLERS:
+        header.insert(0, "PageHandler %s;" % handler)
+        routes[url] = "{ %s, 200, nullptr, nullptr, 0, nullptr, %s, %s }" % (cString(url), handler, "true" if url.endswith("/") else "false")
+
+    # findWifiRoute() relies on the order: it stops scanning at the first URL past the one asked for
+    urls = sorted(routes.keys())
+
+    out = []
+    out.append("// Generated by python/softapPages.py from softap/: do not edit")
+    out.append("")
+    out.append("#ifndef wifi_pages_h")
+    out.append("#define wifi_pages_h")
+    out.append("")
+    out.append('#include "wifi-setup.h"')
+    out.append("")
+    out.extend(header)
+    out.append("")
+    out.append("#define NUM_WIFI_ROUTES     %d" % len(urls))
+    out.append("")
+    out.append("constexpr Page wifiRoutes[NUM_WIFI_ROUTES] = {")
+    out.extend("    %s," % routes[url] for url in urls)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+
+    with open(os.path.join(root, "src", "wifi-pages.h"), "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    with open(os.path.join(root, "src", "wifi-pages.cpp"), "w") as f:
+        f.write("\n".join(source).rstrip("\n") + "\n")
+
+    print("%d pages: %d bytes, %d gzipped; %d routes" % (len(PAGES), rawTotal, gzTotal, len(urls)))
+
+if __name__ == "__main__":
+    main()
@@ -31,13 +31,23 @@
 #define admin_h
 
 #include "Particle.h"
+#include "command.h"
 #include "light.h"
 #include "pulse.h"
+#include "sequence.h"
+#include "fade.h"
+#include "greeting.h"
 
 extern bool debugEnabled;
 extern Light lamp;
 extern LightPulser lightPulse;
 extern Timer fader;
+extern SequencePlayer sequencer;
+extern Timer sequenceTimer;
+extern ColourFade colourFade;
+extern Timer fadeTimer;
+extern Greeting greeting;
+extern Timer greetingTimer;
 
 // Generic admin handler
 int AdminHandler(String command);
@@ -45,12 +55,9 @@ int AdminHandler(String command);
 // Action routines
 int PrintKnownNetworks(void);
 int ForgetNetworkConfiguration(void);
-int EnableUSBSerial(String command);
-int EnableDebug(String command);
-int AddNetworkCredentials(String *command);
-int EnableLEDControl(String command);
-
-// Utility to split a String into individual strings on spaces
-int splitStringToArray(String arguments, String *target);
+int EnableUSBSerial(KEYWORD setting);
+int EnableDebug(KEYWORD setting);
+int AddNetworkCredentials(const CommandLine &command);
+int EnableLEDControl(KEYWORD setting);
 
 #endif
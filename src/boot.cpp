@@ -0,0 +1,159 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "boot.h"
+#include "admin.h"
+
+#include <stdio.h>
+#include <string.h>
+
+retained BOOT_RECORD bootRecord;
+
+char bootReport[BOOT_REPORT_LENGTH];
+
+static const char *milestoneNames[NUM_BOOT_MILESTONES] = {
+    "setup", "pwm", "colour", "functions", "cloud", "greeting", "command"
+};
+
+static void updateBootReport(void)
+{
+    int n = snprintf(bootReport, sizeof(bootReport), "boot %lu%s", (unsigned long)bootRecord.boots, bootRecord.fastBoot ? " fast" : "");
+    
+    for( int i = 0; i < NUM_BOOT_MILESTONES && n < (int)sizeof(bootReport); i++)
+    {
+        if( bootRecord.reached & (1 << i))
+        {
+            n += snprintf(bootReport + n, sizeof(bootReport) - n, " %s=%lu", milestoneNames[i], (unsigned long)bootRecord.micros[i]);
+        }
+        else
+        {
+            n += snprintf(bootReport + n, sizeof(bootReport) - n, " %s=-", milestoneNames[i]);
+        }
+    }
+}
+
+// Call first thing in setup(): anything retained from before a reset is kept, except the old milestones
+void bootStart(void)
+{
+    if( bootRecord.magic != BOOT_RECORD_MAGIC)
+    {
+        memset(&bootRecord, 0, sizeof(bootRecord));
+        bootRecord.magic = BOOT_RECORD_MAGIC;
+        bootRecord.level = 100;
+    }
+    
+    bootRecord.boots++;
+    bootRecord.reached = 0;
+    
+    bootMilestone(BOOT_SETUP);
+}
+
+// Only the first time through each milestone is recorded
+void bootMilestone(BOOT_MILESTONE milestone)
+{
+    if( bootRecord.reached & (1 << milestone))
+    {
+        return;
+    }
+    
+    bootRecord.micros[milestone] = micros();
+    bootRecord.reached |= 1 << milestone;
+    
+    updateBootReport();
+}
+
+bool bootReached(BOOT_MILESTONE milestone)
+{
+    return bootRecord.reached & (1 << milestone);
+}
+
+void bootPrintMilestones(void)
+{
+    Serial.printf("Boot %lu%s\n", (unsigned long)bootRecord.boots, bootRecord.fastBoot ? " (fast)" : "");
+    
+    for( int i = 0; i < NUM_BOOT_MILESTONES; i++)
+    {
+        if( bootRecord.reached & (1 << i))
+        {
+            Serial.printf("  %-10s %10lu us\n", milestoneNames[i], (unsigned long)bootRecord.micros[i]);
+        }
+        else
+        {
+            Serial.printf("  %-10s          -\n", milestoneNames[i]);
+        }
+    }
+}
+
+bool bootFastEnabled(void)
+{
+    return bootRecord.fastBoot;
+}
+
+int bootSetFast(KEYWORD setting)
+{
+    switch( setting)
+    {
+        case KW_ON:     bootRecord.fastBoot = true;     break;
+        case KW_OFF:    bootRecord.fastBoot = false;    break;
+        default:        return -1;
+    }
+    
+    updateBootReport();
+    
+    return 0;
+}
+
+void bootRememberColour(COLOUR colour)
+{
+    bootRecord.red = colour.r;
+    bootRecord.green = colour.g;
+    bootRecord.blue = colour.b;
+    bootRecord.colourSaved = true;
+}
+
+void bootRememberLevel(int level)
+{
+    bootRecord.level = level;
+}
+
+bool bootSavedColour(COLOUR *colour, int *level)
+{
+    if( !bootRecord.colourSaved)
+    {
+        return false;
+    }
+    
+    colour->r = bootRecord.red;
+    colour->g = bootRecord.green;
+    colour->b = bootRecord.blue;
+    *level = bootRecord.level;
+    
+    return true;
+}
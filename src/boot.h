@@ -0,0 +1,93 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef boot_h
+#define boot_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "light.h"
+#include "command.h"
+
+// Points on the way from power on to taking commands, in the order we expect to pass them
+typedef enum
+{
+    BOOT_SETUP = 0,             // setup() entered: the system firmware has started us
+    BOOT_PWM_READY,             // Colour resolution set and the PWM outputs configured
+    BOOT_COLOUR_SHOWN,          // First colour written: the saved one with fast boot, otherwise off
+    BOOT_FUNCTIONS_REGISTERED,  // Cloud functions and variables registered
+    BOOT_CLOUD_CONNECTED,
+    BOOT_GREETING_DONE,         // (not reached with fast boot)
+    BOOT_FIRST_COMMAND,         // First cloud command handled
+    NUM_BOOT_MILESTONES
+} BOOT_MILESTONE;
+
+#define BOOT_RECORD_MAGIC   0x4C414D50  // "LAMP"
+#define BOOT_REPORT_LENGTH  160
+
+/*
+ * Kept in retained (backup) memory, so it survives a reset: the fast boot setting, the colour to come back to,
+ * and when this boot reached each milestone (micros())
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t boots;
+    bool     fastBoot;
+    bool     colourSaved;
+    uint16_t red;
+    uint16_t green;
+    uint16_t blue;
+    uint8_t  level;
+    uint8_t  reached;           // One bit per milestone
+    uint32_t micros[NUM_BOOT_MILESTONES];
+} BOOT_RECORD;
+
+extern BOOT_RECORD bootRecord;
+
+// Milestones as text, exposed to the cloud: "boot N setup=us pwm=us ..." ('-' for not reached yet)
+extern char bootReport[BOOT_REPORT_LENGTH];
+
+void bootStart(void);
+void bootMilestone(BOOT_MILESTONE milestone);
+bool bootReached(BOOT_MILESTONE milestone);
+void bootPrintMilestones(void);
+
+// Fast boot: show the last colour as soon as the PWM is set up, and skip the greeting
+bool bootFastEnabled(void);
+int  bootSetFast(KEYWORD setting);
+
+// Remember the colour (and level) to come back to after a reset
+void bootRememberColour(COLOUR colour);
+void bootRememberLevel(int level);
+bool bootSavedColour(COLOUR *colour, int *level);
+
+#endif
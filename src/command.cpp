@@ -0,0 +1,195 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "command.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *name;
+    KEYWORD     keyword;
+} KEYWORD_ENTRY;
+
+// Sorted by name, for a binary search: checked at compile time below
+static constexpr KEYWORD_ENTRY keywordTable[] = {
+    { "ADD",        KW_ADD },
+    { "AES",        KW_AES },
+    { "AES_TKIP",   KW_AES_TKIP },
+    { "AUTO",       KW_AUTO },
+    { "BALANCE",    KW_BALANCE },
+    { "BLUE",       KW_BLUE },
+    { "BOOT",       KW_BOOT },
+    { "BREATHE",    KW_BREATHE },
+    { "CLEAR",      KW_CLEAR },
+    { "DEBUG",      KW_DEBUG },
+    { "DIM",        KW_DIM },
+    { "FADE",       KW_FADE },
+    { "FASTBOOT",   KW_FASTBOOT },
+    { "GAMMA",      KW_GAMMA },
+    { "GREEN",      KW_GREEN },
+    { "LAN",        KW_LAN },
+    { "LED",        KW_LED },
+    { "LEVEL",      KW_LEVEL },
+    { "LIST",       KW_LIST },
+    { "LOOP",       KW_LOOP },
+    { "MANUAL",     KW_MANUAL },
+    { "OFF",        KW_OFF },
+    { "ON",         KW_ON },
+    { "ONCE",       KW_ONCE },
+    { "PALETTE",    KW_PALETTE },
+    { "PAUSE",      KW_PAUSE },
+    { "PERIOD",     KW_PERIOD },
+    { "PLAY",       KW_PLAY },
+    { "PROFILE",    KW_PROFILE },
+    { "RAMP",       KW_RAMP },
+    { "RED",        KW_RED },
+    { "RESUME",     KW_RESUME },
+    { "SEQUENCE",   KW_SEQUENCE },
+    { "SERIAL",     KW_SERIAL },
+    { "SET",        KW_SET },
+    { "SINE",       KW_SINE },
+    { "SPECTRUM",   KW_SPECTRUM },
+    { "STOP",       KW_STOP },
+    { "STREAM",     KW_STREAM },
+    { "TKIP",       KW_TKIP },
+    { "TRIANGLE",   KW_TRIANGLE },
+    { "UNSEC",      KW_UNSEC },
+    { "WAVE",       KW_WAVE },
+    { "WEP",        KW_WEP },
+    { "WPA2",       KW_WPA2 },
+};
+
+#define NUM_KEYWORDS (sizeof(keywordTable) / sizeof(keywordTable[0]))
+
+static constexpr bool keywordLess(const char *a, const char *b)
+{
+    return *a != *b ? *a < *b : (*a != '\0' && keywordLess(a + 1, b + 1));
+}
+
+static constexpr bool keywordTableSorted(unsigned int i)
+{
+    return i + 1 >= NUM_KEYWORDS || (keywordLess(keywordTable[i].name, keywordTable[i + 1].name) && keywordTableSorted(i + 1));
+}
+
+static_assert(keywordTableSorted(0), "keywordTable must be sorted by name");
+static_assert(NUM_KEYWORDS == KW_WPA2, "keywordTable must have an entry for every KEYWORD");
+
+// Compare a word (any case, not NUL terminated) against an upper case keyword
+static int compareKeyword(const char *text, int length, const char *name)
+{
+    for( int i = 0; i < length; i++, name++)
+    {
+        char c = text[i];
+        if( c >= 'a' && c <= 'z') c -= 'a' - 'A';
+        
+        if( c != *name) return c < *name ? -1 : 1;
+    }
+    
+    return *name ? -1 : 0;
+}
+
+KEYWORD lookupKeyword(const char *text, int length)
+{
+    int low = 0;
+    int high = NUM_KEYWORDS - 1;
+    
+    while( low <= high)
+    {
+        int mid = (low + high) / 2;
+        int cmp = compareKeyword(text, length, keywordTable[mid].name);
+        
+        if( cmp == 0) return keywordTable[mid].keyword;
+        
+        if( cmp < 0) high = mid - 1;
+        else low = mid + 1;
+    }
+    
+    return KW_NONE;
+}
+
+// For debug output: "?" for KW_NONE (or anything else not in the table)
+const char *keywordName(KEYWORD keyword)
+{
+    for( unsigned int i = 0; i < NUM_KEYWORDS; i++)
+    {
+        if( keywordTable[i].keyword == keyword) return keywordTable[i].name;
+    }
+    
+    return "?";
+}
+
+CommandLine::CommandLine(const char *command) : numTokens(0)
+{
+    strncpy(buffer, command ? command : "", COMMAND_MAX_LENGTH - 1);
+    buffer[COMMAND_MAX_LENGTH - 1] = '\0';
+    
+    char *p = buffer;
+    
+    while( numTokens < MAX_COMMAND_ARGS)
+    {
+        while( *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') *p++ = '\0';
+        if( !*p) break;
+        
+        tokens[numTokens].text = p;
+        
+        while( *p && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') p++;
+        
+        tokens[numTokens].length = p - tokens[numTokens].text;
+        numTokens++;
+    }
+    
+    // Anything past the last word we have room for is dropped
+    *p = '\0';
+}
+
+const TOKEN &CommandLine::token(int i) const
+{
+    static const TOKEN empty = { "", 0 };
+    
+    return i >= 0 && i < numTokens ? tokens[i] : empty;
+}
+
+KEYWORD CommandLine::keyword(int i) const
+{
+    const TOKEN &t = token(i);
+    
+    return lookupKeyword(t.text, t.length);
+}
+
+long CommandLine::toInt(int i) const
+{
+    return atol(token(i).text);
+}
+
+float CommandLine::toFloat(int i) const
+{
+    return atof(token(i).text);
+}
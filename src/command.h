@@ -0,0 +1,127 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef command_h
+#define command_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+
+// A cloud function argument is at most 63 characters
+#define COMMAND_MAX_LENGTH  64
+#define MAX_COMMAND_ARGS    8
+
+// Every word the command handlers understand. Keep in step with the keyword table in command.cpp
+typedef enum
+{
+    KW_NONE = 0,
+    KW_ADD,
+    KW_AES,
+    KW_AES_TKIP,
+    KW_AUTO,
+    KW_BALANCE,
+    KW_BLUE,
+    KW_BOOT,
+    KW_BREATHE,
+    KW_CLEAR,
+    KW_DEBUG,
+    KW_DIM,
+    KW_FADE,
+    KW_FASTBOOT,
+    KW_GAMMA,
+    KW_GREEN,
+    KW_LAN,
+    KW_LED,
+    KW_LEVEL,
+    KW_LIST,
+    KW_LOOP,
+    KW_MANUAL,
+    KW_OFF,
+    KW_ON,
+    KW_ONCE,
+    KW_PALETTE,
+    KW_PAUSE,
+    KW_PERIOD,
+    KW_PLAY,
+    KW_PROFILE,
+    KW_RAMP,
+    KW_RED,
+    KW_RESUME,
+    KW_SEQUENCE,
+    KW_SERIAL,
+    KW_SET,
+    KW_SINE,
+    KW_SPECTRUM,
+    KW_STOP,
+    KW_STREAM,
+    KW_TKIP,
+    KW_TRIANGLE,
+    KW_UNSEC,
+    KW_WAVE,
+    KW_WEP,
+    KW_WPA2,
+} KEYWORD;
+
+// A word in a command: points into the CommandLine's buffer (and is NUL terminated there)
+typedef struct
+{
+    const char *text;
+    uint8_t     length;
+} TOKEN;
+
+/*
+ * A command split into words, in place, in a fixed buffer: no heap allocation
+ *
+ * Words are separated by spaces. Keywords match regardless of case, and the words themselves are
+ * left as they were sent (SSIDs and passwords are case sensitive). Missing words read as empty, 0 and KW_NONE
+ */
+class CommandLine
+{
+    public:
+        CommandLine(const char *command);
+        
+        int         count(void) const                { return numTokens; }
+        const TOKEN &token(int i) const;
+        const char *text(int i) const                { return token(i).text; }
+        
+        KEYWORD     keyword(int i) const;
+        long        toInt(int i) const;
+        float       toFloat(int i) const;
+        
+    private:
+        char  buffer[COMMAND_MAX_LENGTH];
+        TOKEN tokens[MAX_COMMAND_ARGS];
+        int   numTokens;
+};
+
+KEYWORD lookupKeyword(const char *text, int length);
+const char *keywordName(KEYWORD keyword);
+
+#endif
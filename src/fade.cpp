@@ -0,0 +1,201 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "fade.h"
+#include "admin.h"
+#include "profile.h"
+#include "trace.h"
+
+ColourFade::ColourFade(void) : startTime(0), duration(0), pausedAt(0), active(false), paused(false)
+{
+    for( int i = 0; i < 3; i++)
+    {
+        from[i] = to[i] = position[i] = 0;
+    }
+}
+
+void ColourFade::start(uint32_t red, uint32_t green, uint32_t blue, uint32_t durationMs)
+{
+    // Carry on from where a running fade has got to, to the fraction: otherwise from the lamp's colour
+    if( !active)
+    {
+        COLOUR c = lamp.getColour();
+        
+        position[0] = c.r << FADE_FRACTION_BITS;
+        position[1] = c.g << FADE_FRACTION_BITS;
+        position[2] = c.b << FADE_FRACTION_BITS;
+    }
+    
+    // Clip the target now, so the whole fade is spent on colours the lamp can show
+    uint32_t maxColour = (1 << lamp.getColourResolution()) - 1;
+    uint32_t target[3] = { red, green, blue };
+    
+    for( int i = 0; i < 3; i++)
+    {
+        from[i] = position[i];
+        to[i] = (target[i] > maxColour ? maxColour : target[i]) << FADE_FRACTION_BITS;
+    }
+    
+    startTime = millis();
+    duration = durationMs;
+    active = true;
+    paused = false;
+    
+    update(startTime);
+    
+    if( active)
+    {
+        fadeTimer.start();
+        PROFILE_RESTART(PROFILE_FADE_JITTER);
+    }
+}
+
+void ColourFade::pause(void)
+{
+    if( active && !paused)
+    {
+        uint32_t now = millis();
+        
+        update(now);
+        
+        if( active)
+        {
+            pausedAt = now - startTime;
+            paused = true;
+            fadeTimer.stop();
+        }
+    }
+}
+
+// Returns -1 if there is no paused fade
+int ColourFade::resume(void)
+{
+    if( !active || !paused)
+    {
+        return -1;
+    }
+    
+    startTime = millis() - pausedAt;
+    paused = false;
+    fadeTimer.start();
+    PROFILE_RESTART(PROFILE_FADE_JITTER);
+    
+    return 0;
+}
+
+// Abandon the fade where it is
+void ColourFade::stop(void)
+{
+    if( active)
+    {
+        active = false;
+        paused = false;
+        fadeTimer.stop();
+        
+        lamp.setRestoreColour();
+    }
+}
+
+bool ColourFade::isFading(void)
+{
+    return active && !paused;
+}
+
+void ColourFade::onTick(void)
+{
+    if( active && !paused)
+    {
+        PROFILE_SCOPE(PROFILE_FADE_TICK);
+        PROFILE_INTERVAL(PROFILE_FADE_JITTER, FADE_TICK_MS * 1000);
+        
+        update(millis());
+    }
+}
+
+void ColourFade::update(uint32_t now)
+{
+    uint32_t elapsed = now - startTime;
+    
+    if( elapsed >= duration)
+    {
+        for( int i = 0; i < 3; i++) position[i] = to[i];
+        
+        lamp.setColour(to[0] >> FADE_FRACTION_BITS, to[1] >> FADE_FRACTION_BITS, to[2] >> FADE_FRACTION_BITS);
+        
+        // Finished: the target is now the colour to come back to
+        stop();
+        
+        trace(TRACE_FADE_DONE, to[0] >> FADE_FRACTION_BITS, to[1] >> FADE_FRACTION_BITS, to[2] >> FADE_FRACTION_BITS);
+        return;
+    }
+    
+    uint32_t t = ((uint64_t)elapsed << 16) / duration;
+    
+    for( int i = 0; i < 3; i++)
+    {
+        position[i] = interpolate16(from[i], to[i], t);
+    }
+    
+    // Round to the nearest colour value
+    const int32_t half = 1 << (FADE_FRACTION_BITS - 1);
+    
+    lamp.setColour((position[0] + half) >> FADE_FRACTION_BITS, (position[1] + half) >> FADE_FRACTION_BITS, (position[2] + half) >> FADE_FRACTION_BITS);
+}
+
+/*
+ * FADE r g b ms        fade from the current colour (or from where a fade has got to) to r g b over ms
+ * FADE PAUSE           hold the fade where it is
+ * FADE RESUME          carry on with a paused fade
+ * FADE STOP            abandon the fade, leaving the lamp where it is
+ */
+int SetLampFade(const CommandLine &command)
+{
+    switch( command.keyword(1))
+    {
+        case KW_PAUSE:
+            colourFade.pause();
+            return 0;
+            
+        case KW_RESUME:
+            return colourFade.resume();
+            
+        case KW_STOP:
+            colourFade.stop();
+            return 0;
+            
+        default:
+            if( command.count() < 5 || command.toInt(4) < 0) return -1;
+            
+            // A fade and a sequence would fight over the lamp
+            sequencer.stop();
+            colourFade.start(command.toInt(1), command.toInt(2), command.toInt(3), command.toInt(4));
+            return 0;
+    }
+}
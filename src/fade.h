@@ -0,0 +1,89 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef fade_h
+#define fade_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "light.h"
+#include "command.h"
+
+// Fades update the lamp at a fixed rate, whatever their length
+#define FADE_TICK_MS        20      // 50 frames a second
+
+// Fade positions are kept with 8 fractional bits, so a slow fade (or a retarget) doesn't lose steps to rounding
+#define FADE_FRACTION_BITS  8
+
+int SetLampFade(const CommandLine &command);
+
+// from + (to - from) * t, where t runs from 0 to 65536
+inline int32_t interpolate16(int32_t from, int32_t to, uint32_t t)
+{
+    return from + (((int64_t)(to - from) * t) >> 16);
+}
+
+/*
+ * Cross-fades the lamp from its current colour to a target over a given time, driven by fadeTimer
+ *
+ * The position along the fade is worked out from the time since it started, not by counting ticks, so the fade
+ * takes the time it was given. A new fade, or a pause, starts from wherever the lamp has got to: no visible step
+ */
+class ColourFade
+{
+    public:
+        ColourFade(void);
+        
+        void start(uint32_t red, uint32_t green, uint32_t blue, uint32_t durationMs);
+        void pause(void);
+        int  resume(void);
+        void stop(void);
+        
+        bool isFading(void);
+        
+        void onTick(void);
+        
+    private:
+        void update(uint32_t now);
+        
+        int32_t  from[3];       // Fixed point colours, FADE_FRACTION_BITS fractional bits
+        int32_t  to[3];
+        int32_t  position[3];
+        
+        uint32_t startTime;     // millis() when the fade started (moved on by the time spent paused)
+        uint32_t duration;
+        uint32_t pausedAt;      // Time into the fade when it was paused
+        
+        bool     active;        // Fading, or paused part way
+        bool     paused;
+};
+
+#endif
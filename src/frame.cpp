@@ -0,0 +1,210 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "frame.h"
+#include "light.h"
+#include "pulse.h"
+#include "admin.h"
+#include "sequence.h"
+#include "fade.h"
+#include "trace.h"
+
+// The number of argument bytes after each opcode: 0xFF for opcodes we don't know
+static uint8_t frameArgumentBytes(uint8_t opcode)
+{
+    switch( opcode)
+    {
+        case FRAME_OP_SET:          return 6;
+        case FRAME_OP_LEVEL:        return 1;
+        case FRAME_OP_PULSE_PERIOD: return 2;
+        case FRAME_OP_PULSE:        return 1;
+        case FRAME_OP_SEQUENCE_ADD: return 10;
+        case FRAME_OP_FADE:         return 8;
+        default:                    return 0xFF;
+    }
+}
+
+static int base64Value(char c)
+{
+    if( c >= 'A' && c <= 'Z') return c - 'A';
+    if( c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if( c >= '0' && c <= '9') return c - '0' + 52;
+    if( c == '+') return 62;
+    if( c == '/') return 63;
+    
+    return -1;
+}
+
+// Returns the number of bytes decoded, or -1 if the text isn't base64 or won't fit
+static int base64Decode(const char *text, uint8_t *out, int maxBytes)
+{
+    uint32_t bits = 0;
+    int numBits = 0;
+    int length = 0;
+    
+    for( ; *text && *text != '='; text++)
+    {
+        int value = base64Value(*text);
+        if( value < 0) return -1;
+        
+        bits = (bits << 6) | value;
+        numBits += 6;
+        
+        if( numBits >= 8)
+        {
+            numBits -= 8;
+            if( length >= maxBytes) return -1;
+            out[length++] = (bits >> numBits) & 0xFF;
+        }
+    }
+    
+    return length;
+}
+
+uint8_t frameCrc8(const uint8_t *data, int length)
+{
+    uint8_t crc = 0;
+    
+    while( length--)
+    {
+        crc ^= *data++;
+        for( int i = 0; i < 8; i++)
+        {
+            crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+        }
+    }
+    
+    return crc;
+}
+
+static uint16_t frameUint16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+// Check an operation's arguments without applying it
+static bool validateFrameOperation(const uint8_t *op)
+{
+    switch( op[0])
+    {
+        case FRAME_OP_LEVEL:        return op[1] >= 1 && op[1] <= 100;
+        case FRAME_OP_PULSE_PERIOD: return frameUint16(op + 1) <= 10000;
+        case FRAME_OP_PULSE:        return op[1] <= 1;
+        default:                    return true;
+    }
+}
+
+static int applyFrameOperation(const uint8_t *op)
+{
+    if( !validateFrameOperation(op)) return -1;
+    
+    switch( op[0])
+    {
+        case FRAME_OP_SET:
+            colourFade.stop();
+            sequencer.stop();
+            lamp.setColour(frameUint16(op + 1), frameUint16(op + 3), frameUint16(op + 5));
+            lamp.setRestoreColour();
+            return 0;
+            
+        case FRAME_OP_LEVEL:
+            colourFade.stop();
+            sequencer.stop();
+            lamp.setBrightnessLevel(op[1]);
+            lamp.restoreColour();
+            return 0;
+            
+        case FRAME_OP_PULSE_PERIOD:
+            return SetPulsePeriod(frameUint16(op + 1) / 10.0f);
+            
+        case FRAME_OP_PULSE:
+            lightPulse.enablePulse(op[1] == 1);
+            return 0;
+            
+        case FRAME_OP_SEQUENCE_ADD:
+            return sequencer.add(frameUint16(op + 1), frameUint16(op + 3), frameUint16(op + 5),
+                                 frameUint16(op + 7) * 10, frameUint16(op + 9) * 10) < 0 ? -1 : 0;
+            
+        case FRAME_OP_FADE:
+            sequencer.stop();
+            colourFade.start(frameUint16(op + 1), frameUint16(op + 3), frameUint16(op + 5), frameUint16(op + 7) * 10);
+            return 0;
+    }
+    
+    return -1;
+}
+
+int RunCommandFrame(const char *base64)
+{
+    uint8_t frame[FRAME_MAX_BYTES];
+    int length = base64Decode(base64, frame, FRAME_MAX_BYTES);
+    
+    // Header and CRC at least, the right version and an intact frame
+    if( length < 2 || (frame[0] >> 4) != FRAME_VERSION || frameCrc8(frame, length - 1) != frame[length - 1])
+    {
+        return -1;
+    }
+    
+    bool atomic = frame[0] & FRAME_FLAG_ATOMIC;
+    int end = length - 1;
+    int numOps = 0;
+    int numAdds = 0;
+    
+    // Walk the operations once to check they are all complete (and, if atomic, valid)
+    for( int i = 1; i < end; numOps++)
+    {
+        uint8_t argBytes = frameArgumentBytes(frame[i]);
+        
+        if( argBytes == 0xFF || i + 1 + argBytes > end) return -1;
+        if( atomic && !validateFrameOperation(&frame[i])) return -1;
+        
+        if( frame[i] == FRAME_OP_SEQUENCE_ADD) numAdds++;
+        
+        i += 1 + argBytes;
+    }
+    
+    // An atomic frame's keyframes must all fit, or a full queue would fail it part way through
+    if( atomic && numAdds > sequencer.space()) return -1;
+    
+    if( atomic) lamp.holdOutput();
+    
+    int applied = 0;
+    
+    for( int i = 1; i < end; i += 1 + frameArgumentBytes(frame[i]))
+    {
+        if( applyFrameOperation(&frame[i]) < 0) break;
+        applied++;
+    }
+    
+    if( atomic) lamp.releaseOutput();
+    
+    trace(TRACE_FRAME, applied, numOps);
+    
+    return applied == numOps ? applied : -1;
+}
@@ -0,0 +1,75 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef frame_h
+#define frame_h
+
+#include <stdint.h>
+
+/*
+ * Packed command frames: several lamp operations in one cloud function call
+ *
+ * A frame is FRAME_MARKER followed by the frame bytes in base64 (no padding needed), passed as the
+ * argument to the colour function. Up to 46 bytes fit in the 63 character argument.
+ *
+ *   byte 0         FRAME_VERSION in the top 4 bits, flags in the bottom 4 (FRAME_FLAG_ATOMIC)
+ *   bytes 1..n-2   operations: an opcode byte followed by its fixed size arguments (little endian)
+ *   byte n-1       CRC-8 (polynomial 0x07) of bytes 0..n-2
+ *
+ *   FRAME_OP_SET           r, g, b: uint16 each
+ *   FRAME_OP_LEVEL         level: uint8 (1-100)
+ *   FRAME_OP_PULSE_PERIOD  period: uint16, in tenths of a second (0 turns pulsing off)
+ *   FRAME_OP_PULSE         on: uint8 (0 or 1)
+ *   FRAME_OP_SEQUENCE_ADD  r, g, b, fade, hold: uint16 each, times in hundredths of a second (see SEQUENCE ADD)
+ *   FRAME_OP_FADE          r, g, b, time: uint16 each, time in hundredths of a second (see FADE)
+ *
+ * Operations are applied in order, and the frame stops at the first one that fails. If the frame is
+ * atomic, every operation is checked before any are applied, and the lamp output changes once, at the end.
+ */
+
+#define FRAME_MARKER            '@'
+#define FRAME_VERSION           1
+#define FRAME_FLAG_ATOMIC       0x01
+
+#define FRAME_MAX_BYTES         46
+
+#define FRAME_OP_SET            0x01
+#define FRAME_OP_LEVEL          0x02
+#define FRAME_OP_PULSE_PERIOD   0x03
+#define FRAME_OP_PULSE          0x04
+#define FRAME_OP_SEQUENCE_ADD   0x05
+#define FRAME_OP_FADE           0x06
+
+// Decode and apply a frame (without the marker). Returns the number of operations applied, or -1
+int RunCommandFrame(const char *base64);
+
+// CRC-8, polynomial 0x07: also checks the UDP stream frames (see stream.h) and the saved settings (see persist.h)
+uint8_t frameCrc8(const uint8_t *data, int length);
+
+#endif
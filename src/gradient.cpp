@@ -0,0 +1,165 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "gradient.h"
+
+/*
+   The standard cold => hot colour gradient from http://paulbourke.net/texture_colour/colourspace/ 
+   blue -> cyan -> green -> yellow -> red
+*/
+const GRADIENT_STOP colourRampStops[COLOUR_RAMP_STOPS] = {
+    { 0,                    0,   0,   255 },
+    { GRADIENT_END / 4,     0,   255, 255 },
+    { GRADIENT_END / 2,     0,   255, 0   },
+    { 3 * GRADIENT_END / 4, 255, 255, 0   },
+    { GRADIENT_END,         255, 0,   0   },
+};
+
+/*
+   The "visible spectrum" gradient from https://msdn.microsoft.com/en-us/library/mt712854.aspx
+   magenta -> blue -> green -> yellow -> red
+*/
+const GRADIENT_STOP visibleSpectrumStops[VISIBLE_SPECTRUM_STOPS] = {
+    { 0,                    255, 0,   255 },
+    { GRADIENT_END / 4,     0,   0,   255 },
+    { GRADIENT_END / 2,     0,   255, 0   },
+    { 3 * GRADIENT_END / 4, 255, 255, 0   },
+    { GRADIENT_END,         255, 0,   0   },
+};
+
+// An empty gradient: give it some stops with setStops() before use
+ColourGradient::ColourGradient(void) : stops(nullptr), numStops(0)
+{
+    rangeMin = rangeMax = 0;
+    rangeScale = 0;
+}
+
+// Stops must be in order of position, the first at 0 and the last at GRADIENT_END
+ColourGradient::ColourGradient(const GRADIENT_STOP *stops, int numStops) : stops(stops), numStops(numStops)
+{
+    rangeMin = rangeMax = 0;
+    rangeScale = 0;
+    
+    build(255);
+}
+
+// The stops are not copied: they have to stay put. Call build() afterwards
+void ColourGradient::setStops(const GRADIENT_STOP *newStops, int newNumStops)
+{
+    stops = newStops;
+    numStops = newNumStops;
+}
+
+// Bake the gradient into the table, for colours in the range 0 - maxColour
+void ColourGradient::build(uint32_t maxColour)
+{
+    int stop = 0;
+    
+    if( numStops < 2) return;
+    
+    for( int i = 0; i <= GRADIENT_TABLE_SEGMENTS; i++)
+    {
+        uint32_t position = (i * GRADIENT_END) / GRADIENT_TABLE_SEGMENTS;
+        
+        while( stop < numStops - 2 && position > stops[stop + 1].position) stop++;
+        
+        const GRADIENT_STOP &from = stops[stop];
+        const GRADIENT_STOP &to   = stops[stop + 1];
+        
+        // Two stops at the same place make a hard edge
+        uint32_t span = to.position - from.position;
+        uint32_t past = position - from.position;
+        
+        if( span == 0) span = past = 1;
+        
+        uint8_t fromColour[3] = { from.r, from.g, from.b };
+        uint8_t toColour[3]   = { to.r, to.g, to.b };
+        
+        // Interpolate and scale in one go, rounded to nearest, so that stop colours come out exact
+        for( int c = 0; c < 3; c++)
+        {
+            uint64_t mix = (uint64_t)fromColour[c] * (span - past) + (uint64_t)toColour[c] * past;
+            uint64_t divisor = 255ULL * span;
+            
+            table[i][c] = ((mix * maxColour << GRADIENT_TABLE_FRACTION_BITS) + divisor / 2) / divisor;
+        }
+    }
+}
+
+/*
+   Return the colour for a value in the range [minValue, maxValue]
+   The colour is clipped at the end of the scale if the value is outside the range
+*/
+COLOUR ColourGradient::colourFromRange(int32_t value, int32_t minValue, int32_t maxValue)
+{
+    COLOUR c;
+    const uint32_t *entry;
+    
+    if( value >= maxValue)
+    {
+        entry = table[GRADIENT_TABLE_SEGMENTS];
+    }
+    else if( value <= minValue)
+    {
+        entry = table[0];
+    }
+    else
+    {
+        // Sensors tend to report against the same range every time: only divide when it changes
+        if( minValue != rangeMin || maxValue != rangeMax)
+        {
+            rangeMin = minValue;
+            rangeMax = maxValue;
+            rangeScale = 0xFFFFFFFFFFFFULL / ((uint32_t)maxValue - (uint32_t)minValue);
+        }
+        
+        // Position along the gradient, as a 0.32 fixed point fraction (value - minValue < range, so this fits)
+        uint32_t position = (((uint64_t)((uint32_t)value - (uint32_t)minValue) * rangeScale)) >> 16;
+        
+        int     segment  = position >> (32 - GRADIENT_SEGMENT_BITS);
+        int64_t fraction = (position >> (32 - GRADIENT_SEGMENT_BITS - 15)) & 0x7FFF;
+        
+        const uint32_t *from = table[segment];
+        const uint32_t *to   = table[segment + 1];
+        
+        const int shift = 15 + GRADIENT_TABLE_FRACTION_BITS;
+        
+        c.r = (((int64_t)from[0] << 15) + ((int64_t)to[0] - from[0]) * fraction) >> shift;
+        c.g = (((int64_t)from[1] << 15) + ((int64_t)to[1] - from[1]) * fraction) >> shift;
+        c.b = (((int64_t)from[2] << 15) + ((int64_t)to[2] - from[2]) * fraction) >> shift;
+        
+        return c;
+    }
+    
+    c.r = entry[0] >> GRADIENT_TABLE_FRACTION_BITS;
+    c.g = entry[1] >> GRADIENT_TABLE_FRACTION_BITS;
+    c.b = entry[2] >> GRADIENT_TABLE_FRACTION_BITS;
+    
+    return c;
+}
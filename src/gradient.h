@@ -0,0 +1,92 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef gradient_h
+#define gradient_h
+
+#include <stdint.h>
+
+#include "light.h"
+
+// Positions along a gradient run from 0 to GRADIENT_END
+#define GRADIENT_END                1024
+
+// The gradient is baked into a table of evenly spaced colours, and we interpolate between them
+// Must be a power of 2. Stops which fall on a table entry are reproduced exactly
+#define GRADIENT_TABLE_SEGMENTS     32
+#define GRADIENT_SEGMENT_BITS       5
+#define GRADIENT_TABLE_FRACTION_BITS 8
+
+// A point on a gradient: its position, and its colour as 8 bit fractions of full scale (255 == fully on)
+typedef struct
+{
+    uint16_t position;
+    uint8_t  r;
+    uint8_t  g;
+    uint8_t  b;
+} GRADIENT_STOP;
+
+/*
+ * A colour gradient, mapping a value in a range onto a colour
+ *
+ * The stops are baked into a table at the current colour resolution, so mapping a value is a
+ * multiply, a table lookup and a fixed point interpolation: no floating point and no divide
+ * (as long as the range is the same as last time). Rebuild the table when the resolution changes
+ */
+class ColourGradient
+{
+    public:
+        ColourGradient(void);
+        ColourGradient(const GRADIENT_STOP *stops, int numStops);
+        
+        void   setStops(const GRADIENT_STOP *stops, int numStops);
+        void   build(uint32_t maxColour);
+        COLOUR colourFromRange(int32_t value, int32_t minValue, int32_t maxValue);
+        
+    private:
+        const GRADIENT_STOP *stops;
+        int numStops;
+        
+        // Colours are held with GRADIENT_TABLE_FRACTION_BITS fractional bits, so interpolation doesn't compound rounding
+        uint32_t table[GRADIENT_TABLE_SEGMENTS + 1][3];
+        
+        // The reciprocal of the last range we were asked for: 2^48 / (maxValue - minValue)
+        int32_t  rangeMin;
+        int32_t  rangeMax;
+        uint64_t rangeScale;
+};
+
+// The two built-in gradients
+extern const GRADIENT_STOP colourRampStops[];
+extern const GRADIENT_STOP visibleSpectrumStops[];
+
+#define COLOUR_RAMP_STOPS       5
+#define VISIBLE_SPECTRUM_STOPS  5
+
+#endif
@@ -0,0 +1,103 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "greeting.h"
+#include "admin.h"
+#include "boot.h"
+
+Greeting::Greeting(void) : state(GREETING_IDLE), stateStart(0)
+{
+}
+
+void Greeting::start(void)
+{
+    lamp.set8BitColour(0, 255, 255);
+    
+    state = GREETING_FLASH;
+    stateStart = millis();
+    
+    greetingTimer.start();
+}
+
+// Stop where we are and put the lamp back, ready for the command which interrupted us
+void Greeting::cancel(void)
+{
+    if( state != GREETING_IDLE)
+    {
+        finish();
+    }
+}
+
+bool Greeting::isRunning(void)
+{
+    return state != GREETING_IDLE;
+}
+
+void Greeting::finish(void)
+{
+    state = GREETING_IDLE;
+    greetingTimer.stop();
+    
+    lamp.restoreColour();
+    
+    bootMilestone(BOOT_GREETING_DONE);
+}
+
+void Greeting::onTick(void)
+{
+    uint32_t elapsed = millis() - stateStart;
+    
+    switch( state)
+    {
+        case GREETING_FLASH:
+            if( elapsed >= GREETING_FLASH_MS)
+            {
+                state = GREETING_RAMP;
+                stateStart += GREETING_FLASH_MS;
+                onTick();
+            }
+            break;
+            
+        case GREETING_RAMP:
+            if( elapsed >= GREETING_RAMP_MS)
+            {
+                finish();
+            }
+            else
+            {
+                COLOUR c = lamp.colourRampFromRange(elapsed, 0, GREETING_RAMP_MS);
+                lamp.setColour(c.r, c.g, c.b);
+            }
+            break;
+            
+        default:
+            break;
+    }
+}
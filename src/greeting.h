@@ -0,0 +1,75 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef greeting_h
+#define greeting_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "light.h"
+
+#define GREETING_TICK_MS    20
+#define GREETING_FLASH_MS   1000    // Cyan, to say we're connected
+#define GREETING_RAMP_MS    10240   // Then once through the colour ramp
+
+/*
+ * The "hello" when we connect to the cloud: a flash of cyan and a run through the colour ramp, then back
+ * to the last colour we were asked for
+ *
+ * Runs from greetingTimer, so start() returns at once and commands are handled while it plays.
+ * Any colour or pulse command cancels it first
+ */
+class Greeting
+{
+    public:
+        Greeting(void);
+        
+        void start(void);
+        void cancel(void);
+        bool isRunning(void);
+        
+        void onTick(void);
+        
+    private:
+        typedef enum
+        {
+            GREETING_IDLE,
+            GREETING_FLASH,
+            GREETING_RAMP
+        } GREETING_STATE;
+        
+        void finish(void);
+        
+        GREETING_STATE state;
+        uint32_t       stateStart;  // millis() when we entered the state
+};
+
+#endif
@@ -0,0 +1,564 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "lan-server.h"
+#include "light.h"
+#include "pulse.h"
+#include "admin.h"
+#include "profile.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+retained LAN_SETTINGS lanSettings;
+
+char lanReport[LAN_REPORT_LENGTH];
+
+typedef struct
+{
+    const char *path;
+    user_function_int_str_t handler;
+} LAN_ENDPOINT;
+
+// The same handlers as the cloud functions of these names
+static const LAN_ENDPOINT lanEndpoints[] = {
+    { "/colour",    LampControl },
+    { "/pulse",     PulseLamp },
+    { "/admin",     AdminHandler },
+};
+
+#define NUM_LAN_ENDPOINTS (sizeof(lanEndpoints) / sizeof(lanEndpoints[0]))
+
+static const char *statusText(int status)
+{
+    switch( status)
+    {
+        case 200:   return "OK";
+        case 400:   return "Bad Request";
+        case 401:   return "Unauthorized";
+        case 404:   return "Not Found";
+        case 405:   return "Method Not Allowed";
+        case 413:   return "Payload Too Large";
+        case 431:   return "Request Header Fields Too Large";
+        default:    return "Error";
+    }
+}
+
+// Just past the blank line which ends the headers, or -1 if it hasn't arrived yet
+static int findHeaderEnd(const char *buffer, int length)
+{
+    for( int i = 3; i < length; i++)
+    {
+        if( buffer[i] == '\n' && buffer[i - 1] == '\r' && buffer[i - 2] == '\n' && buffer[i - 3] == '\r') return i + 1;
+    }
+    
+    return -1;
+}
+
+static bool fieldIs(const char *text, int length, const char *value)
+{
+    return (int)strlen(value) == length && strncasecmp(text, value, length) == 0;
+}
+
+// A header's value (name matched in any case, leading spaces skipped), or nullptr. The lines end in CRLF, up to end
+static const char *findHeader(const char *headers, const char *end, const char *name, int *length)
+{
+    int nameLength = strlen(name);
+    
+    for( const char *line = headers; line < end; )
+    {
+        const char *eol = line;
+        while( eol < end && *eol != '\r') eol++;
+        
+        if( eol - line > nameLength && line[nameLength] == ':' && strncasecmp(line, name, nameLength) == 0)
+        {
+            const char *value = line + nameLength + 1;
+            while( value < eol && (*value == ' ' || *value == '\t')) value++;
+            
+            *length = eol - value;
+            return value;
+        }
+        
+        line = eol + 2;
+    }
+    
+    *length = 0;
+    return nullptr;
+}
+
+// Authorization: Bearer <token>, compared in constant time
+static bool tokenMatches(const char *value, int length)
+{
+    int expected = strlen(lanSettings.token);
+    
+    if( !value || expected == 0 || length < 7 || strncasecmp(value, "Bearer ", 7) != 0) return false;
+    
+    value += 7;
+    length -= 7;
+    
+    uint8_t diff = length != expected;
+    
+    for( int i = 0; i < expected; i++)
+    {
+        diff |= (i < length ? value[i] : 0) ^ lanSettings.token[i];
+    }
+    
+    return diff == 0;
+}
+
+static int hexValue(char c)
+{
+    if( c >= '0' && c <= '9') return c - '0';
+    if( c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if( c >= 'A' && c <= 'F') return c - 'A' + 10;
+    
+    return -1;
+}
+
+// The arg field of a form encoded body, as the cloud API takes, decoded into out: its length, or -1 if it is missing or too long
+static int formArgument(const char *body, int length, char *out, int size)
+{
+    const char *end = body + length;
+    
+    for( const char *field = body; field < end; )
+    {
+        const char *fieldEnd = field;
+        while( fieldEnd < end && *fieldEnd != '&') fieldEnd++;
+        
+        if( fieldEnd - field >= 4 && strncmp(field, "arg=", 4) == 0)
+        {
+            int n = 0;
+            
+            for( const char *p = field + 4; p < fieldEnd; p++)
+            {
+                char c = *p;
+                
+                if( c == '+')
+                {
+                    c = ' ';
+                }
+                else if( c == '%' && fieldEnd - p > 2 && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0)
+                {
+                    c = hexValue(p[1]) << 4 | hexValue(p[2]);
+                    p += 2;
+                }
+                
+                if( n >= size - 1) return -1;
+                out[n++] = c;
+            }
+            
+            out[n] = '\0';
+            return n;
+        }
+        
+        field = fieldEnd + 1;
+    }
+    
+    return -1;
+}
+
+LanServer::LanServer(void) : server(LAN_PORT)
+{
+    listening = false;
+    
+    for( LAN_CLIENT &c : clients)
+    {
+        c.open = false;
+        c.length = 0;
+    }
+    
+    connections = 0;
+    requests = 0;
+    unauthorised = 0;
+    errors = 0;
+    lastLatencyUs = 0;
+    worstLatencyUs = 0;
+}
+
+// Call from loop(): listens while enabled and the WiFi is up, and answers whatever has arrived
+void LanServer::poll(void)
+{
+    bool wanted = lanSettings.magic == LAN_SETTINGS_MAGIC && lanSettings.enabled && WiFi.ready();
+    
+    if( wanted && !listening) start();
+    else if( !wanted && listening) stop();
+    
+    if( !listening) return;
+    
+    accept();
+    
+    for( LAN_CLIENT &c : clients)
+    {
+        if( c.open) service(c);
+    }
+}
+
+int LanServer::enable(const char *token)
+{
+    int length = strlen(token);
+    
+    if( length == 0)
+    {
+        // Turn back on with the token we had
+        if( lanSettings.magic != LAN_SETTINGS_MAGIC || lanSettings.token[0] == '\0') return -1;
+    }
+    else
+    {
+        if( length < LAN_TOKEN_MIN || length > LAN_TOKEN_MAX) return -1;
+        
+        memset(&lanSettings, 0, sizeof(lanSettings));
+        lanSettings.magic = LAN_SETTINGS_MAGIC;
+        strcpy(lanSettings.token, token);
+    }
+    
+    lanSettings.enabled = true;
+    
+    return 0;
+}
+
+void LanServer::disable(void)
+{
+    lanSettings.enabled = false;
+}
+
+bool LanServer::isListening(void)
+{
+    return listening;
+}
+
+uint32_t LanServer::getRequests(void)
+{
+    return requests;
+}
+
+uint32_t LanServer::getLastLatencyUs(void)
+{
+    return lastLatencyUs;
+}
+
+void LanServer::updateReport(void)
+{
+    int open = 0;
+    
+    for( LAN_CLIENT &c : clients)
+    {
+        if( c.open) open++;
+    }
+    
+    snprintf(lanReport, sizeof(lanReport), "%s clients=%d connections=%lu requests=%lu unauthorised=%lu errors=%lu last=%lu worst=%lu",
+             listening ? "on" : "off", open, (unsigned long)connections, (unsigned long)requests, (unsigned long)unauthorised,
+             (unsigned long)errors, (unsigned long)lastLatencyUs, (unsigned long)worstLatencyUs);
+}
+
+void LanServer::start(void)
+{
+    listening = server.begin();
+}
+
+void LanServer::stop(void)
+{
+    for( LAN_CLIENT &c : clients)
+    {
+        if( c.open) drop(c);
+    }
+    
+    server.stop();
+    listening = false;
+}
+
+// Take on any new connections, as far as we have room
+void LanServer::accept(void)
+{
+    for( int i = 0; i < LAN_MAX_CLIENTS; i++)
+    {
+        TCPClient incoming = server.available();
+        
+        if( !incoming.connected())
+        {
+            incoming.stop();
+            return;
+        }
+        
+        LAN_CLIENT *slot = nullptr;
+        
+        for( LAN_CLIENT &c : clients)
+        {
+            if( !c.open)
+            {
+                slot = &c;
+                break;
+            }
+        }
+        
+        if( !slot)
+        {
+            incoming.stop();
+            errors++;
+            continue;
+        }
+        
+        slot->client = incoming;
+        slot->open = true;
+        slot->length = 0;
+        slot->lastActive = millis();
+        connections++;
+    }
+}
+
+void LanServer::service(LAN_CLIENT &c)
+{
+    if( !c.client.connected())
+    {
+        drop(c);
+        return;
+    }
+    
+    int space = LAN_REQUEST_BUFFER - c.length;
+    
+    if( space > 0 && c.client.available() > 0)
+    {
+        int n = c.client.read((uint8_t *)c.buffer + c.length, space);
+        
+        if( n > 0)
+        {
+            c.length += n;
+            c.lastActive = millis();
+        }
+    }
+    
+    // Answer pipelined requests in the order they came
+    for( int i = 0; i < LAN_REQUESTS_PER_POLL; i++)
+    {
+        int used = handleRequest(c);
+        
+        if( used == 0) break;
+        
+        if( used < 0)
+        {
+            drop(c);
+            return;
+        }
+        
+        c.length -= used;
+        memmove(c.buffer, c.buffer + used, c.length);
+    }
+    
+    if( millis() - c.lastActive > LAN_IDLE_TIMEOUT_MS) drop(c);
+}
+
+// Answer the first request in the buffer: how much of the buffer it took, 0 if it hasn't all arrived yet,
+// or -1 if the connection should be closed
+int LanServer::handleRequest(LAN_CLIENT &c)
+{
+    uint32_t startTicks = System.ticks();
+    int headerEnd = findHeaderEnd(c.buffer, c.length);
+    
+    if( headerEnd < 0)
+    {
+        if( c.length < LAN_REQUEST_BUFFER) return 0;
+        
+        respond(c, 431, "", "{\"error\":\"headers too large\"}", startTicks, false);
+        return -1;
+    }
+    
+    // Request line: method, target and version
+    const char *lineEnd = (const char *)memchr(c.buffer, '\r', headerEnd);
+    const char *method = c.buffer;
+    const char *target = (const char *)memchr(method, ' ', lineEnd - method);
+    const char *version = target ? (const char *)memchr(target + 1, ' ', lineEnd - target - 1) : nullptr;
+    
+    if( !version)
+    {
+        respond(c, 400, "", "{\"error\":\"bad request line\"}", startTicks, false);
+        return -1;
+    }
+    
+    int methodLength = target - method;
+    target++;
+    int targetLength = version - target;
+    version++;
+    int versionLength = lineEnd - version;
+    
+    bool keepAlive;
+    
+    if( fieldIs(version, versionLength, "HTTP/1.1")) keepAlive = true;
+    else if( fieldIs(version, versionLength, "HTTP/1.0")) keepAlive = false;
+    else
+    {
+        respond(c, 400, "", "{\"error\":\"bad version\"}", startTicks, false);
+        return -1;
+    }
+    
+    const char *headers = lineEnd + 2;
+    const char *headersEnd = c.buffer + headerEnd - 2;
+    const char *value;
+    int length;
+    
+    if( (value = findHeader(headers, headersEnd, "Connection", &length)))
+    {
+        if( fieldIs(value, length, "close")) keepAlive = false;
+        else if( fieldIs(value, length, "keep-alive")) keepAlive = true;
+    }
+    
+    // The body must fit in the buffer along with the headers
+    int bodyLength = 0;
+    
+    if( (value = findHeader(headers, headersEnd, "Content-Length", &length)))
+    {
+        for( int i = 0; i < length; i++)
+        {
+            if( value[i] < '0' || value[i] > '9' || bodyLength > LAN_REQUEST_BUFFER)
+            {
+                respond(c, value[i] < '0' || value[i] > '9' ? 400 : 413, "", "{\"error\":\"bad length\"}", startTicks, false);
+                return -1;
+            }
+            
+            bodyLength = bodyLength * 10 + value[i] - '0';
+        }
+    }
+    
+    int used = headerEnd + bodyLength;
+    
+    if( used > LAN_REQUEST_BUFFER)
+    {
+        respond(c, 413, "", "{\"error\":\"too large\"}", startTicks, false);
+        return -1;
+    }
+    
+    if( used > c.length) return 0;
+    
+    // From here the request is complete, so the connection can carry on whatever the answer
+    value = findHeader(headers, headersEnd, "Authorization", &length);
+    
+    if( !tokenMatches(value, length))
+    {
+        unauthorised++;
+        return respond(c, 401, "WWW-Authenticate: Bearer\r\n", "{\"error\":\"unauthorised\"}", startTicks, keepAlive) ? used : -1;
+    }
+    
+    const char *query = (const char *)memchr(target, '?', targetLength);
+    if( query) targetLength = query - target;
+    
+    const LAN_ENDPOINT *endpoint = nullptr;
+    
+    for( unsigned int i = 0; i < NUM_LAN_ENDPOINTS; i++)
+    {
+        if( fieldIs(target, targetLength, lanEndpoints[i].path)) endpoint = &lanEndpoints[i];
+    }
+    
+    if( !endpoint)
+    {
+        return respond(c, 404, "", "{\"error\":\"not found\"}", startTicks, keepAlive) ? used : -1;
+    }
+    
+    if( !fieldIs(method, methodLength, "POST"))
+    {
+        return respond(c, 405, "Allow: POST\r\n", "{\"error\":\"POST only\"}", startTicks, keepAlive) ? used : -1;
+    }
+    
+    // The command: the whole body, or the arg field of a form
+    char command[COMMAND_MAX_LENGTH];
+    const char *body = c.buffer + headerEnd;
+    int commandLength = -1;
+    
+    value = findHeader(headers, headersEnd, "Content-Type", &length);
+    
+    if( value && length >= 33 && strncasecmp(value, "application/x-www-form-urlencoded", 33) == 0)
+    {
+        commandLength = formArgument(body, bodyLength, command, sizeof(command));
+    }
+    else if( bodyLength < (int)sizeof(command))
+    {
+        memcpy(command, body, bodyLength);
+        command[bodyLength] = '\0';
+        commandLength = bodyLength;
+    }
+    
+    if( commandLength < 0)
+    {
+        return respond(c, 400, "", "{\"error\":\"bad command\"}", startTicks, keepAlive) ? used : -1;
+    }
+    
+    char result[32];
+    snprintf(result, sizeof(result), "{\"return_value\":%d}", endpoint->handler(String(command)));
+    
+    return respond(c, 200, "", result, startTicks, keepAlive) ? used : -1;
+}
+
+// Write a whole response in one go, timing the request up to here. False if it couldn't be sent, or the connection is to close
+bool LanServer::respond(LAN_CLIENT &c, int status, const char *headers, const char *body, uint32_t startTicks, bool keepAlive)
+{
+    uint32_t ticks = System.ticks() - startTicks;
+    uint32_t us = ticks / System.ticksPerMicrosecond();
+    char response[256];
+    
+    int n = snprintf(response, sizeof(response),
+                     "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %d\r\nServer-Timing: lamp;dur=%lu.%03lu\r\n%s%s\r\n%s",
+                     status, statusText(status), (int)strlen(body), (unsigned long)(us / 1000), (unsigned long)(us % 1000),
+                     keepAlive ? "" : "Connection: close\r\n", headers, body);
+    
+    requests++;
+    if( status >= 400 && status != 401) errors++;
+    lastLatencyUs = us;
+    if( us > worstLatencyUs) worstLatencyUs = us;
+    
+#if LAMP_PROFILE
+    profileRecord(PROFILE_LAN_REQUEST, ticks);
+#endif
+    
+    if( n >= (int)sizeof(response)) return false;
+    
+    return c.client.write((const uint8_t *)response, n) == (size_t)n && keepAlive;
+}
+
+void LanServer::drop(LAN_CLIENT &c)
+{
+    c.client.stop();
+    c.open = false;
+    c.length = 0;
+}
+
+// LAN ON [<token>]: answer on the local network (a token of 8 to 32 characters, or the last one). LAN OFF
+int LanCommand(const CommandLine &command)
+{
+    switch( command.keyword(1))
+    {
+        case KW_ON:
+            return lanServer.enable(command.text(2));
+            
+        case KW_OFF:
+            lanServer.disable();
+            return 0;
+            
+        default:
+            return -1;
+    }
+}
@@ -0,0 +1,126 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef lan_server_h
+#define lan_server_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "command.h"
+
+// The colour, pulse and admin functions, over HTTP/1.1 on the local network: no round trip through the cloud
+#define LAN_PORT                80
+#define LAN_MAX_CLIENTS         4
+#define LAN_REQUEST_BUFFER      512     // Per client: a request's headers and body must fit
+#define LAN_REQUESTS_PER_POLL   8       // Per client, so a long pipeline can't hold up loop()
+#define LAN_IDLE_TIMEOUT_MS     30000
+#define LAN_TOKEN_MIN           8
+#define LAN_TOKEN_MAX           32
+#define LAN_REPORT_LENGTH       160
+
+#define LAN_SETTINGS_MAGIC      0x4C414E31  // "LAN1"
+
+// Kept in retained memory, like the fast boot setting, so a reset doesn't need the cloud to turn the server back on
+typedef struct
+{
+    uint32_t magic;
+    bool     enabled;
+    char     token[LAN_TOKEN_MAX + 1];
+} LAN_SETTINGS;
+
+// A connection, and what it has sent that we haven't answered yet
+typedef struct
+{
+    TCPClient client;
+    bool      open;
+    uint32_t  lastActive;
+    uint16_t  length;
+    char      buffer[LAN_REQUEST_BUFFER];
+} LAN_CLIENT;
+
+/*
+ * A small HTTP/1.1 server for controlling the lamp without the cloud
+ *
+ *   POST /colour, /pulse or /admin    Authorization: Bearer <token>
+ *
+ * The body is the command, as plain text or as the cloud API's form (arg=<command>), and it goes to the same
+ * handler as the cloud function of that name. The reply is {"return_value":N}, with a Server-Timing header
+ * giving how long the request took to handle. Connections are kept alive, and pipelined requests on one are
+ * answered in order
+ *
+ * Everything is polled from loop(): the server listens whenever it is enabled and the WiFi is up
+ */
+class LanServer
+{
+    public:
+        LanServer(void);
+        
+        void poll(void);
+        
+        // LAN ON <token> (or just LAN ON to keep the last one) and LAN OFF
+        int  enable(const char *token);
+        void disable(void);
+        bool isListening(void);
+        
+        uint32_t getRequests(void);
+        uint32_t getLastLatencyUs(void);
+        void updateReport(void);
+        
+    private:
+        void start(void);
+        void stop(void);
+        void accept(void);
+        void service(LAN_CLIENT &c);
+        int  handleRequest(LAN_CLIENT &c);
+        bool respond(LAN_CLIENT &c, int status, const char *headers, const char *body, uint32_t startTicks, bool keepAlive);
+        void drop(LAN_CLIENT &c);
+        
+        TCPServer  server;
+        bool       listening;
+        LAN_CLIENT clients[LAN_MAX_CLIENTS];
+        
+        uint32_t connections;
+        uint32_t requests;
+        uint32_t unauthorised;
+        uint32_t errors;
+        uint32_t lastLatencyUs;
+        uint32_t worstLatencyUs;
+};
+
+extern LanServer lanServer;
+extern LAN_SETTINGS lanSettings;
+
+// Requests, errors and latency, exposed to the cloud: refreshed by updateReport()
+extern char lanReport[LAN_REPORT_LENGTH];
+
+int LanCommand(const CommandLine &command);
+
+#endif
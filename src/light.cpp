@@ -1,4 +1,3 @@
-
 /*
  * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
  *
@@ -30,7 +29,14 @@
  
 #include "light.h"
 #include "admin.h"
-#include "math.h"
+#include "gradient.h"
+#include "palette.h"
+#include "frame.h"
+#include "sequence.h"
+#include "fade.h"
+#include "boot.h"
+#include "profile.h"
+#include "trace.h"
 #include "application.h"
 
 // Easy access for the current colour values. Perhaps these can be classs variables and exposed to the Cloud?
@@ -39,38 +45,80 @@ int redLevel;
 int greenLevel;
 int blueLevel;
 int bitsPerPixel;
+int powerLevel;
+
+// The built-in colour gradients, baked at the current colour resolution
+static ColourGradient colourRamp(colourRampStops, COLOUR_RAMP_STOPS);
+static ColourGradient visibleSpectrum(visibleSpectrumStops, VISIBLE_SPECTRUM_STOPS);
 
 
-Light::Light(int rPin, int gPin, int bPin ) : redPin(rPin), greenPin(gPin), bluePin(bPin), brightnessLevel(255)
+Light::Light(int rPin, int gPin, int bPin ) : redPin(rPin), greenPin(gPin), bluePin(bPin), brightnessLevel(100)
 {
     lampControlIsEnabled = false;
     bitsPerPixel = 8;
     
     redLevel = greenLevel = blueLevel = 0;
+    powerLevel = 100;
     
     savedColour.r = savedColour.g = savedColour.b = 0;
+    currentColour.r = currentColour.g = currentColour.b = 0;
+    
+    // No hardware access here (we're constructed before setup() runs): setColourResolution() finishes these off
+    PWM_CHANNEL *channels[] = { &redChannel, &greenChannel, &blueChannel };
+    int pins[] = { rPin, gPin, bPin };
+    int transferChannels[] = { TRANSFER_RED, TRANSFER_GREEN, TRANSFER_BLUE };
+    
+    for( int i = 0; i < 3; i++)
+    {
+        channels[i]->pin = pins[i];
+        channels[i]->transferChannel = transferChannels[i];
+        channels[i]->maxRange = (1UL << bitsPerPixel) - 1;
+        channels[i]->frequency = 0;
+        channels[i]->duty = 0;
+        channels[i]->committed = false;
+        channels[i]->pending = false;
+    }
+    
+    outputHeld = false;
+    
+    pwmWrites = skippedPwmWrites = 0;
 };
 
 
 // Sets the colour resolution of the PWM pins (and set them to be outputs, just in case)
+// The PWM channel settings only depend on this, so work them out once here
 void Light::setColourResolution(int bits)
 {
-    pinMode(redPin, OUTPUT);
-    pinMode(greenPin, OUTPUT);
-    pinMode(bluePin, OUTPUT);
+    PWM_CHANNEL *channels[] = { &redChannel, &greenChannel, &blueChannel };
     
-    analogWriteResolution(redPin, bits);    
-    analogWriteResolution(greenPin, bits);  
-    analogWriteResolution(bluePin, bits);   
+    for( int i = 0; i < 3; i++)
+    {
+        PWM_CHANNEL &channel = *channels[i];
+        
+        pinMode(channel.pin, OUTPUT);
+        analogWriteResolution(channel.pin, bits);
+        
+        channel.maxRange  = (1UL << bits) - 1;
+        channel.frequency = analogWriteMaxFrequency(channel.pin) / 2;
+        
+        // Force the next write through: the pin has a new resolution
+        channel.committed = false;
+    }
     
     bitsPerPixel = bits;
+    
+    output.setResolution(bits);
+    
+    colourRamp.build(redChannel.maxRange);
+    visibleSpectrum.build(redChannel.maxRange);
+    palettes.build(redChannel.maxRange);
 }
 
 // Returns the colour resolution (in bits)
 // ... so not quite the inverst of 
 int Light::getColourResolution()
 {
-    return analogWriteResolution(redPin);
+    return bitsPerPixel;
 }
 
 /*
@@ -78,9 +126,12 @@ int Light::getColourResolution()
  * R,G,B can take values in the range 0-<colour resolution>. These are the permitted PWM settings 
  *
  * Values are clamped if they are outside these ranges
+ * Only the pins whose duty cycle actually changes are written
  */
 COLOUR Light::setColour(uint32_t red, uint32_t green, uint32_t blue)
 {
+    PROFILE_SCOPE(PROFILE_SET_COLOUR);
+    
     setRed(red);
     setGreen(green);
     setBlue(blue);
@@ -98,54 +149,80 @@ COLOUR Light::restoreColour(void)
     return setColour(savedColour.r, savedColour.g, savedColour.b);    
 }
 
-void Light::setRed(uint32_t red)
+void Light::holdOutput(void)
 {
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    int maxFreq = analogWriteMaxFrequency(redPin);
-    
-    if( red > maxColourRange ) red = maxColourRange;
-
-    // Use half the max PWM frequency
-    analogWrite(redPin, red, maxFreq / 2 );
-
-    currentColour.r = redLevel = red;
+    outputHeld = true;
 }
 
-void Light::setGreen(uint32_t green)
+void Light::releaseOutput(void)
 {
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    int maxFreq = analogWriteMaxFrequency(greenPin);
+    PWM_CHANNEL *channels[] = { &redChannel, &greenChannel, &blueChannel };
     
-    // Clamp all the colours to be within allowed ranges
-
-    if( green > maxColourRange ) green = maxColourRange;
+    outputHeld = false;
+    
+    for( int i = 0; i < 3; i++)
+    {
+        if( channels[i]->pending)
+        {
+            channels[i]->pending = false;
+            writeChannel(*channels[i], channels[i]->pendingValue);
+        }
+    }
+}
 
+// Clamp the colour to the allowed range, map it through the output stage (brightness, gamma, white balance)
+// and write it to the pin ... unless the pin is already there. Returns the clamped colour value
+// The app thread and the timers both write: the check, the write and the record of it go together with interrupts off
+uint32_t Light::writeChannel(PWM_CHANNEL &channel, uint32_t value)
+{
+    if( value > channel.maxRange ) value = channel.maxRange;
+    
+    if( outputHeld)
+    {
+        channel.pendingValue = value;
+        channel.pending = true;
+        return value;
+    }
+    
+    uint32_t duty = output.table(channel.transferChannel)[value >> output.indexShift()];
+    
+    ATOMIC_BLOCK()
+    {
+        if( channel.committed && duty == channel.duty)
+        {
+            skippedPwmWrites++;
+        }
+        else
+        {
+            analogWrite(channel.pin, duty, channel.frequency);
+            
+            channel.duty = duty;
+            channel.committed = true;
+            pwmWrites++;
+        }
+    }
     
-    // Use half the max PWM frequency
-    analogWrite(greenPin, green, maxFreq / 2 );
+    return value;
+}
 
-    currentColour.g = greenLevel = green;
+void Light::setRed(uint32_t red)
+{
+    currentColour.r = redLevel = writeChannel(redChannel, red);
 }
 
+void Light::setGreen(uint32_t green)
+{
+    currentColour.g = greenLevel = writeChannel(greenChannel, green);
+}
 
 void Light::setBlue(uint32_t blue)
 {
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    int maxFreq = analogWriteMaxFrequency(bluePin);
-    
-    // Clamp all the colours to be within allowed ranges
-    if( blue > maxColourRange ) blue = maxColourRange;
-
-    // Use half the max PWM frequency
-    analogWrite(bluePin, blue, maxFreq / 2 );
-
-    currentColour.b = blueLevel = blue;
+    currentColour.b = blueLevel = writeChannel(blueChannel, blue);
 }
 
 COLOUR Light::set8BitColour(uint8_t red, uint8_t green, uint8_t blue)
 {
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    
+    uint32_t maxColourRange = redChannel.maxRange;
     
     uint32_t cRed    = (red * maxColourRange) / 255;
     uint32_t cGreen  = (green * maxColourRange) / 255;
@@ -167,9 +244,12 @@ void Light::setExternalLampControl(bool lampControl)
 void Light::setBrightnessLevel(int level)
 {
     if(level < 1) level = 1;
-    if(level > 255) level = 255;
+    if(level > 100) level = 100;
+    
+    brightnessLevel = powerLevel = level;    
+    bootRememberLevel(level);
     
-    brightnessLevel = level;    
+    output.setBrightnessLevel(level);
 }
 
 int Light::getBrightnessLevel(void)
@@ -177,65 +257,47 @@ int Light::getBrightnessLevel(void)
     return brightnessLevel;
 }
 
+// Gamma for the colour values: 1.0 (the default) is linear
+void Light::setGamma(float gamma)
+{
+    output.setGamma(gamma);
+}
+
+float Light::getGamma(void)
+{
+    return output.getGamma();
+}
+
+// White balance trims, as a percentage of full output for each colour
+void Light::setWhiteBalance(int red, int green, int blue)
+{
+    output.setWhiteBalance(red, green, blue);
+}
+
+uint32_t Light::getPwmWrites(void)
+{
+    return pwmWrites;
+}
+
+uint32_t Light::getSkippedPwmWrites(void)
+{
+    return skippedPwmWrites;
+}
+
 /*
    Return a RGB colour value given a scalar v in the range [vmin,vmax]
-   In this case each colour component ranges from 0 (no contribution) to
-   255 (fully saturated), modifications for other ranges is trivial.
+   Each colour component ranges from 0 (no contribution) to the maximum
+   for the current colour resolution (fully saturated).
    The colour is clipped at the end of the scales if v is outside
    the range [vmin,vmax]
    
    This is a standard cold => hot colour gradient from http://paulbourke.net/texture_colour/colourspace/ 
+   See gradient.cpp for the gradient definitions
 
 */
-COLOUR Light::colourRampFromRange(float value, float vmin, float vmax)
+COLOUR Light::colourRampFromRange(int32_t value, int32_t vmin, int32_t vmax)
 {
-    
-    COLOUR c;  
-    double dv;
-
-    int maxColour = pow(2,getColourResolution()) - 1;
-    c.r = c.g = c.b = maxColour;    // Lamp ON
-    
-    if( debugEnabled) {
-        Serial.printf("----\n");
-        Serial.printf("computing colour - ramp algorithm\n");
-        Serial.printf("Max: %d\n", maxColour);
-        Serial.printf("Value, vMin, vMax %f %f %f\n", value, vmin, vmax);
-    }
-    if (value < vmin)
-        value = vmin;
-      
-    if (value > vmax)
-        value = vmax;
-      
-    dv = vmax - vmin;
-
-    if (value < (vmin + 0.25 * dv)) {
-        c.r = 0;
-        c.g = (4 * (value - vmin) / dv) * maxColour;
-    } 
-    else if (value < (vmin + 0.5 * dv)) 
-    {
-        c.r = 0;
-        c.b = maxColour + (4 * (vmin + 0.25 * dv - value) / dv) * maxColour;
-    } 
-    else if (value < (vmin + 0.75 * dv)) 
-    {
-        c.r = (4 * (value - vmin - 0.5 * dv) / dv) * maxColour;
-        c.b = 0;
-    } 
-    else 
-    {
-        c.g = maxColour + (4 * (vmin + 0.75 * dv - value) / dv) * maxColour;
-        c.b = 0;
-    }
-
-    if( debugEnabled) {
-        Serial.printf("Red: %d\n", c.r);
-        Serial.printf("Green: %d\n", c.g);
-        Serial.printf("Blue: %d\n", c.b);
-        Serial.printf("----------\n");        
-    }
+    COLOUR c = colourRamp.colourFromRange(value, vmin, vmax);
     
     return(c);
 }
@@ -248,184 +310,237 @@ COLOUR Light::colourRampFromRange(float value, float vmin, float vmax)
  *
  * https://msdn.microsoft.com/en-us/library/mt712854.aspx
   */
-  
-
-COLOUR Light::visibleColourFromRange(float value, float vmin, float vmax)
+COLOUR Light::visibleColourFromRange(int32_t value, int32_t vmin, int32_t vmax)
 {
+    COLOUR c = visibleSpectrum.colourFromRange(value, vmin, vmax);
     
-    COLOUR c;  
-    double dv;
-    int maxColour = pow(2,getColourResolution()) - 1;
-
-    if( debugEnabled) {
-        Serial.printf("----\n");
-        Serial.printf("computing colour - spectrum algorithm\n");
-        Serial.printf("Max: %d\n", maxColour);
-        Serial.printf("Value, vMin, vMax %f %f %f\n", value, vmin, vmax);
-    }
-    
-    if (value < vmin)
-        value = vmin;
-      
-    if (value > vmax)
-        value = vmax;
-      
-    dv = vmax - vmin;
-
-    if (value < (vmin + 0.25 * dv)) {
-        c.r = maxColour - ((4 * (value - vmin) / dv) * maxColour);
-        c.g = 0;
-        c.b = maxColour;
-    } 
-    else if (value < (vmin + 0.5 * dv)) 
-    {
-        c.r = 0;
-        c.g = (4 * (value - vmin - 0.25 * dv) / dv) * maxColour;
-        c.b = maxColour + (4 * (vmin + 0.25 * dv - value) / dv) * maxColour;
-    } 
-    else if (value < (vmin + 0.75 * dv)) 
-    {
-        c.r = (4 * (value - vmin - 0.5 * dv) / dv) * maxColour;
-        c.g = maxColour;
-        c.b = 0;
-    } 
-    else 
-    {
-        c.r = maxColour;
-        c.g = maxColour + (4 * (vmin + 0.75 * dv - value) / dv) * maxColour;
-        c.b = 0;
-    }
+    return(c);
+}
 
-    if( debugEnabled) {
-        Serial.printf("Red: %d\n", c.r);
-        Serial.printf("Green: %d\n", c.g);
-        Serial.printf("Blue: %d\n", c.b);
-        Serial.printf("----------\n");        
-    }
+void Light::setRestoreColour(void)
+{
+    savedColour = currentColour;    
     
-    return(c);
+    bootRememberColour(savedColour);
 }
 
-// Rapidly cycle the Lamp through the colour spectrum: a sort of "hello" message
-// Does this after connecting and before powering down the lamp and waiting for a command
-void Light::rapidColourRamp(void)
+// Remember a colour without showing it: restoreColour() will
+void Light::setRestoreColour(COLOUR colour)
 {
-    float value;
-    COLOUR colour;
+    savedColour = colour;
     
-    for( value = 0; value < 1024; delay(10), value++)
-    {
-        colour = colourRampFromRange(value,0,1024);
-        setColour(colour.r, colour.g, colour.b);
-    }
+    bootRememberColour(savedColour);
 }
 
-void Light::setRestoreColour(void)
+COLOUR Light::getRestoreColour(void)
 {
-    savedColour = currentColour;    
+    return savedColour;
 }
 
 // Exposed Lamp control command
 int LampControl(String command)
 {
-    int numArgs;
+    PROFILE_SCOPE(PROFILE_LAMP_CONTROL);
+    
     int retVal = -1;
     
-    command.trim();
-    command.toUpperCase();
+    bootMilestone(BOOT_FIRST_COMMAND);
     
-    String lampCommand[8];
-    numArgs = splitStringToArray(command, lampCommand);
+    // The connection greeting gives way to any command
+    greeting.cancel();
     
-    if( debugEnabled) {
-        Serial.printf("Colour command received: ");
-        
-        for( int i=0; i < numArgs; i++) {
-            Serial.printf("%s ",lampCommand[i].c_str());
-        }
-        Serial.printf("\n");
+    // Packed frames are base64, so case matters: hand them off before anything else
+    if( command.charAt(0) == FRAME_MARKER)
+    {
+        return RunCommandFrame(command.c_str() + 1);
     }
     
-    String action = lampCommand[0];
+    CommandLine lampCommand(command.c_str());
+    
+    trace(TRACE_COLOUR_COMMAND, lampCommand.keyword(0), lampCommand.toInt(1), lampCommand.toInt(2), lampCommand.toInt(3));
     
     // Now just hand off to the handlers
     // However we have to remembed the colour, so that we can reset it
     
-    if( action == "SET")
-    {
-        retVal = SetLampColour(lampCommand[1], lampCommand[2], lampCommand[3]);
-        lamp.setRestoreColour();
-    }
-    else if (action == "RAMP")
-    {
-        retVal = SetLampColourFromRamp(lampCommand[1], lampCommand[2], lampCommand[3]);
-        lamp.setRestoreColour();
-    }
-    else if (action == "SPECTRUM")
-    {
-        retVal = SetLampColourFromSpectrum( lampCommand[1], lampCommand[2], lampCommand[3] );
-        lamp.setRestoreColour();
-    }
-    else
+    switch( lampCommand.keyword(0))
     {
-        if (debugEnabled)
-        {
-            Serial.printf("That is not a valid command. Ignored");
-        }
+        case KW_SET:
+            retVal = SetLampColour(lampCommand);
+            lamp.setRestoreColour();
+            break;
+            
+        case KW_RAMP:
+            retVal = SetLampColourFromRamp(lampCommand);
+            lamp.setRestoreColour();
+            break;
+            
+        case KW_SPECTRUM:
+            retVal = SetLampColourFromSpectrum(lampCommand);
+            lamp.setRestoreColour();
+            break;
+            
+        case KW_PALETTE:
+            retVal = SetLampPalette(lampCommand);
+            
+            // Only a colour change is remembered, not a palette upload
+            if( retVal == 0 && lampCommand.keyword(2) != KW_ADD && lampCommand.keyword(2) != KW_CLEAR)
+            {
+                lamp.setRestoreColour();
+            }
+            break;
+            
+        case KW_FADE:
+            retVal = SetLampFade(lampCommand);
+            break;
+            
+        case KW_SEQUENCE:
+            retVal = SetLampSequence(lampCommand);
+            break;
+            
+        case KW_LEVEL:
+            retVal = SetLampMaximumBrightness(lampCommand);
+            break;
+            
+        case KW_GAMMA:
+            retVal = SetLampGamma(lampCommand);
+            break;
+            
+        case KW_BALANCE:
+            retVal = SetLampWhiteBalance(lampCommand);
+            break;
+            
+        default:
+            trace(TRACE_INVALID_COMMAND, KW_NONE);
+            break;
     }
 
-
     return retVal;
 }
 
-int SetLampColour(String arg1, String arg2, String arg3)
+// SET RED|GREEN|BLUE value, or SET r g b
+int SetLampColour(const CommandLine &command)
 {
     uint32_t r, g, b;
     
+    // An explicit colour takes over from a fade or sequence, which would write over it on their next tick
+    colourFade.stop();
+    sequencer.stop();
+    
     int retval = -1;
-    if( arg1 == "RED")
+    switch( command.keyword(1))
     {
-        r = arg2.toInt();
-        lamp.setRed(r);
-        retval = r;
+        case KW_RED:
+            r = command.toInt(2);
+            lamp.setRed(r);
+            retval = r;
+            break;
+            
+        case KW_GREEN:
+            g = command.toInt(2);
+            lamp.setGreen(g);
+            retval = g;
+            break;
+            
+        case KW_BLUE:
+            b = command.toInt(2);
+            lamp.setBlue(b);
+            retval = b;
+            break;
+            
+        default:
+            // Assume that the three arguments are R, G, B integer values
+            // If the values are not valid, we just get 0 
+            r = command.toInt(1);
+            g = command.toInt(2);
+            b = command.toInt(3);
+            lamp.setColour(r,g,b);
+            retval = 0;
+            break;
     }
-    else if (arg1 == "GREEN")
-    {
-        g = arg2.toInt();
-        lamp.setGreen(g);
-        retval = g;
-    }
-    else if (arg1 == "BLUE")
+
+    return retval;    
+}
+
+// Set the maximum brightness level (for Alexa dimming)
+int SetLampMaximumBrightness(const CommandLine &command)
+{
+    int retval = 0;
+    int level;
+    
+    switch( command.keyword(1))
     {
-        b = arg2.toInt();
-        lamp.setBlue(b);
-        retval = b;
+        case KW_SET:
+            level = command.toInt(2);
+            break;
+            
+        case KW_DIM:
+            level = lamp.getBrightnessLevel() + command.toInt(2);
+            break;
+            
+        default:
+            // Just assume it is a straight set command
+            level = command.toInt(1);
+            break;
     }
-    else
+    
+    colourFade.stop();
+    sequencer.stop();
+    
+    lamp.setBrightnessLevel(level);
+    
+    // Reset the colour based on this dimming level
+    lamp.restoreColour();
+    
+    return retval;
+    
+}
+// Set the colour gamma: 1.0 is linear
+int SetLampGamma(const CommandLine &command)
+{
+    float gamma = command.toFloat(1);
+    
+    if( gamma <= 0)
     {
-        // Assume that the three arguments are R, G, B integer values
-        // If the values are not valid, we just get 0 
-        r = arg1.toInt();
-        g = arg2.toInt();
-        b = arg3.toInt();
-        lamp.setColour(r,g,b);
-        retval = 0;
+        return -1;
     }
+    
+    lamp.setGamma(gamma);
+    
+    // Redisplay the current colour through the new curve
+    COLOUR c = lamp.getColour();
+    lamp.setColour(c.r, c.g, c.b);
+    
+    return 0;
+}
 
-    return retval;    
+// Set the white balance trims: the percentage of full output for red, green and blue
+int SetLampWhiteBalance(const CommandLine &command)
+{
+    lamp.setWhiteBalance(command.toInt(1), command.toInt(2), command.toInt(3));
+    
+    COLOUR c = lamp.getColour();
+    lamp.setColour(c.r, c.g, c.b);
+    
+    return 0;
 }
 
 // Just use integers for colour values and range passed in ... 
-int SetLampColourFromRamp(String arg1, String arg2, String arg3)
+int SetLampColourFromRamp(const CommandLine &command)
 {
-    float v, vmin, vmax;
+    int32_t v, vmin, vmax;
     
-    v = (float)arg1.toInt();
-    vmin = (float)arg2.toInt();
-    vmax = (float)arg3.toInt();
+    v = command.toInt(1);
+    vmin = command.toInt(2);
+    vmax = command.toInt(3);
     
     COLOUR col = lamp.colourRampFromRange(v, vmin, vmax);
     
+    trace(TRACE_GRADIENT_INPUT, KW_RAMP, v, vmin, vmax);
+    trace(TRACE_GRADIENT_COLOUR, col.r, col.g, col.b);
+    
+    colourFade.stop();
+    sequencer.stop();
+    
     lamp.setColour(col.r, col.g, col.b);
     
     return 0;
@@ -433,16 +548,22 @@ int SetLampColourFromRamp(String arg1, String arg2, String arg3)
 }
 
 
-int SetLampColourFromSpectrum(String arg1, String arg2, String arg3)
+int SetLampColourFromSpectrum(const CommandLine &command)
 {
-    float v, vmin, vmax;
+    int32_t v, vmin, vmax;
     
-    v = (float)arg1.toInt();
-    vmin = (float)arg2.toInt();
-    vmax = (float)arg3.toInt();
+    v = command.toInt(1);
+    vmin = command.toInt(2);
+    vmax = command.toInt(3);
     
     COLOUR col = lamp.visibleColourFromRange(v, vmin, vmax);
     
+    trace(TRACE_GRADIENT_INPUT, KW_SPECTRUM, v, vmin, vmax);
+    trace(TRACE_GRADIENT_COLOUR, col.r, col.g, col.b);
+    
+    colourFade.stop();
+    sequencer.stop();
+    
     lamp.setColour(col.r, col.g, col.b);
     
     return 0;    
@@ -33,6 +33,8 @@
 #include <stdint.h>
 
 #include "Particle.h"
+#include "transfer.h"
+#include "command.h"
 
 extern int redLevel;
 extern int greenLevel;
@@ -47,14 +49,30 @@ typedef struct
     uint32_t b;
 } COLOUR;
 
+// One PWM output: everything needed to write it is worked out when the resolution changes, not on every write
+// "duty" shadows what the pin is actually set to, so unchanged writes can be skipped
+typedef struct
+{
+    int      pin;
+    int      transferChannel;   // Which of the output transfer tables to use
+    uint32_t maxRange;          // Largest colour value at the current resolution
+    uint32_t frequency;         // PWM frequency: half the maximum for the current resolution
+    uint32_t duty;              // Duty cycle last written to the pin
+    bool     committed;         // False until the pin has been written at the current resolution
+    uint32_t pendingValue;      // Colour value waiting for the output to be released (see holdOutput())
+    bool     pending;
+} PWM_CHANNEL;
+
 // Generic lamp handler, exposed to the cloud
 int LampControl(String command);
 int PulseLamp(String command);
 
-int SetLampColour(String arg1, String arg2, String arg3);
-int SetLampMaximumBrightness(String arg1, String arg2);
-int SetLampColourFromRamp(String arg1, String arg2, String arg3);
-int SetLampColourFromSpectrum(String arg1, String arg2, String arg3);
+int SetLampColour(const CommandLine &command);
+int SetLampMaximumBrightness(const CommandLine &command);
+int SetLampGamma(const CommandLine &command);
+int SetLampWhiteBalance(const CommandLine &command);
+int SetLampColourFromRamp(const CommandLine &command);
+int SetLampColourFromSpectrum(const CommandLine &command);
 
 
 // 
@@ -70,6 +88,10 @@ class Light
 
         COLOUR getColour(void);
         
+        // While the output is held, colour changes are remembered but not written: release writes them all at once
+        void holdOutput(void);
+        void releaseOutput(void);
+        
         // Utility functions
         void setRed( uint32_t red);
         void setGreen( uint32_t green);
@@ -84,18 +106,39 @@ class Light
         void setBrightnessLevel(int level);
         int  getBrightnessLevel(void);
         
-        void   rapidColourRamp(void);
+        void  setGamma(float gamma);
+        float getGamma(void);
+        void  setWhiteBalance(int red, int green, int blue);
+        
+        // PWM write statistics: writes made, and writes skipped because the pin already had that duty cycle
+        uint32_t getPwmWrites(void);
+        uint32_t getSkippedPwmWrites(void);
         
         void   setRestoreColour(void); 
-        COLOUR colourRampFromRange(float value, float minValue, float maxValue);
-        COLOUR visibleColourFromRange(float value, float minValue, float maxValue);
+        void   setRestoreColour(COLOUR colour);
+        COLOUR getRestoreColour(void);
+        COLOUR colourRampFromRange(int32_t value, int32_t minValue, int32_t maxValue);
+        COLOUR visibleColourFromRange(int32_t value, int32_t minValue, int32_t maxValue);
         
     private:
+        uint32_t writeChannel(PWM_CHANNEL &channel, uint32_t value);
+        
         int redPin;
         int greenPin;
         int bluePin;
         int brightnessLevel;
         
+        PWM_CHANNEL redChannel;
+        PWM_CHANNEL greenChannel;
+        PWM_CHANNEL blueChannel;
+        
+        OutputTransfer output;
+        
+        uint32_t pwmWrites;
+        uint32_t skippedPwmWrites;
+        
+        bool outputHeld;
+        
         bool lampControlIsEnabled;
 
         COLOUR currentColour;
@@ -26,471 +26,177 @@
  * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
- 
-#include "light.h"
-#include "admin.h"
-#include "math.h"
-#include "application.h"
-
-// Easy access for the current colour values. Perhaps these can be classs variables and exposed to the Cloud?
-
-int redLevel;
-int greenLevel;
-int blueLevel;
-int bitsPerPixel;
-int powerLevel;
-
-
-Light::Light(int rPin, int gPin, int bPin ) : redPin(rPin), greenPin(gPin), bluePin(bPin), brightnessLevel(100)
-{
-    lampControlIsEnabled = false;
-    bitsPerPixel = 8;
-    
-    redLevel = greenLevel = blueLevel = 0;
-    powerLevel = 100;
-    
-    savedColour.r = savedColour.g = savedColour.b = 0;
-};
-
-
-// Sets the colour resolution of the PWM pins (and set them to be outputs, just in case)
-void Light::setColourResolution(int bits)
-{
-    pinMode(redPin, OUTPUT);
-    pinMode(greenPin, OUTPUT);
-    pinMode(bluePin, OUTPUT);
-    
-    analogWriteResolution(redPin, bits);    
-    analogWriteResolution(greenPin, bits);  
-    analogWriteResolution(bluePin, bits);   
-    
-    bitsPerPixel = bits;
-}
-
-// Returns the colour resolution (in bits)
-// ... so not quite the inverst of 
-int Light::getColourResolution()
-{
-    return analogWriteResolution(redPin);
-}
-
-/*
- * Sets the actual lampc colour
- * R,G,B can take values in the range 0-<colour resolution>. These are the permitted PWM settings 
- *
- * Values are clamped if they are outside these ranges
- */
-COLOUR Light::setColour(uint32_t red, uint32_t green, uint32_t blue)
-{
-    setRed(red);
-    setGreen(green);
-    setBlue(blue);
-    
-    return currentColour;
-}
-
-COLOUR Light::getColour(void)
-{
-    return currentColour;    
-}
-
-COLOUR Light::restoreColour(void)
-{
-    return setColour(savedColour.r, savedColour.g, savedColour.b);    
-}
-
-void Light::setRed(uint32_t red)
-{
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    uint32_t colourToSet;
-    int maxFreq = analogWriteMaxFrequency(redPin);
-    
-    if( red > maxColourRange ) red = maxColourRange;
-
-    // And further correct for the maximum brightness
-    colourToSet = (red * brightnessLevel) / 100;
-    
-    // Use half the max PWM frequency
-    analogWrite(redPin, colourToSet, maxFreq / 2 );
-
-    currentColour.r = redLevel = red;
-}
 
-void Light::setGreen(uint32_t green)
-{
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    uint32_t colourToSet;
-    int maxFreq = analogWriteMaxFrequency(greenPin);
-    
-    // Clamp all the colours to be within allowed ranges
+#include "Particle.h"
+#include "softap_http.h"
 
-    if( green > maxColourRange ) green = maxColourRange;
+#include "light.h"
+#include "pulse.h"
+#include "admin.h"
+#include "sequence.h"
+#include "fade.h"
+#include "greeting.h"
+#include "boot.h"
+#include "profile.h"
+#include "trace.h"
+#include "wifi-setup.h"
+#include "lan-server.h"
+#include "stream.h"
+#include "publisher.h"
+#include "state.h"
+#include "persist.h"
 
-    // And further correct for the maximum brightness
-    colourToSet = (green * brightnessLevel) / 100;
-    
-    // Use half the max PWM frequency
-    analogWrite(greenPin, colourToSet, maxFreq / 2 );
+// Keep the application loop running while the system thread (re)connects: we drive the lamp from the LED in the meantime
+SYSTEM_THREAD(ENABLED);
 
-    currentColour.g = greenLevel = green;
-}
+// Serve our own setup pages from the SoftAP when in listening mode
+STARTUP(softap_set_application_page_handler(setupWiFiPage, nullptr));
 
+// The boot record (fast boot setting, last colour, boot milestones) lives in backup memory
+STARTUP(System.enableFeature(FEATURE_RETAINED_MEMORY));
 
-void Light::setBlue(uint32_t blue)
-{
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    uint32_t colourToSet;
-    int maxFreq = analogWriteMaxFrequency(bluePin);
-    
-    // Clamp all the colours to be within allowed ranges
-    if( blue > maxColourRange ) blue = maxColourRange;
-    
-    // And further correct for the maximum brightness
-    colourToSet = (blue * brightnessLevel) / 100;
+// Default colour resolution, in bits per colour
+#define DEFAULT_COLOUR_BITS     12
 
-    // Use half the max PWM frequency
-    analogWrite(bluePin, colourToSet, maxFreq / 2 );
+// The lamp is driven from three PWM outputs
+#define RED_PIN     D0
+#define GREEN_PIN   D1
+#define BLUE_PIN    D2
 
-    currentColour.b = blueLevel = blue;
-}
+bool debugEnabled = false;
 
-COLOUR Light::set8BitColour(uint8_t red, uint8_t green, uint8_t blue)
-{
-    uint32_t maxColourRange = pow(2,getColourResolution()) - 1;
-    
-    
-    uint32_t cRed    = (red * maxColourRange) / 255;
-    uint32_t cGreen  = (green * maxColourRange) / 255;
-    uint32_t cBlue   = (blue * maxColourRange) / 255;
-    
-    return setColour( cRed, cGreen, cBlue);
-}
+Light       lamp(RED_PIN, GREEN_PIN, BLUE_PIN);
+LightPulser lightPulse;
+Timer       fader(PULSE_MAX_TICK_MS, &LightPulser::onTimeout, lightPulse);
+SequencePlayer sequencer;
+Timer       sequenceTimer(SEQUENCE_TICK_MS, &SequencePlayer::onTick, sequencer);
+ColourFade  colourFade;
+Timer       fadeTimer(FADE_TICK_MS, &ColourFade::onTick, colourFade);
+Greeting    greeting;
+Timer       greetingTimer(GREETING_TICK_MS, &Greeting::onTick, greeting);
+Connection  conn;
+Timer       reconnectTimer(RECONNECT_MIN_MS, &Connection::onReconnectTimer, conn, true);
+LanServer   lanServer;
+ColourStream colourStream;
+StatePublisher statePublisher;
+SettingsStore settingsStore;
 
-bool Light::lampControlEnabled(void)
-{
-    return lampControlIsEnabled;
-}
+// How many times loop() has seen us get the cloud
+uint32_t    seenConnections;
 
-void Light::setExternalLampControl(bool lampControl)
+// The lamp follows the on-board LED whenever we are not connected to the cloud (so it flashes
+// green when connecting and blue when listening), or when it has been told to with LED AUTO
+// With fast boot, the lamp keeps its colour while we connect
+void ledChangeHandler(uint8_t r, uint8_t g, uint8_t b)
 {
-    lampControlIsEnabled = lampControl;
+    if( lamp.lampControlEnabled() || (!conn.isConnected() && !bootFastEnabled()))
+    {
+        lamp.set8BitColour(r, g, b);
+    }
 }
 
-void Light::setBrightnessLevel(int level)
+void setup()
 {
-    if(level < 1) level = 1;
-    if(level > 100) level = 100;
+    COLOUR saved;
+    int level;
     
-    brightnessLevel = powerLevel = level;    
-}
-
-int Light::getBrightnessLevel(void)
-{
-    return brightnessLevel;
-}
-
-/*
-   Return a RGB colour value given a scalar v in the range [vmin,vmax]
-   In this case each colour component ranges from 0 (no contribution) to
-   255 (fully saturated), modifications for other ranges is trivial.
-   The colour is clipped at the end of the scales if v is outside
-   the range [vmin,vmax]
-   
-   This is a standard cold => hot colour gradient from http://paulbourke.net/texture_colour/colourspace/ 
-
-*/
-COLOUR Light::colourRampFromRange(float value, float vmin, float vmax)
-{
+    bootStart();
     
-    COLOUR c;  
-    double dv;
-
-    int maxColour = pow(2,getColourResolution()) - 1;
-    c.r = c.g = c.b = maxColour;    // Lamp ON
+    // The settings saved before a power cut (or reset) come back before we go near the cloud
+    settingsStore.begin();
+    lamp.setColourResolution(settingsStore.getColourResolution(DEFAULT_COLOUR_BITS));
+    bootMilestone(BOOT_PWM_READY);
+    settingsStore.restore();
     
-    if( debugEnabled) {
-        Serial.printf("----\n");
-        Serial.printf("computing colour - ramp algorithm\n");
-        Serial.printf("Max: %d\n", maxColour);
-        Serial.printf("Value, vMin, vMax %f %f %f\n", value, vmin, vmax);
-    }
-    if (value < vmin)
-        value = vmin;
-      
-    if (value > vmax)
-        value = vmax;
-      
-    dv = vmax - vmin;
-
-    if (value < (vmin + 0.25 * dv)) {
-        c.r = 0;
-        c.g = (4 * (value - vmin) / dv) * maxColour;
-    } 
-    else if (value < (vmin + 0.5 * dv)) 
-    {
-        c.r = 0;
-        c.b = maxColour + (4 * (vmin + 0.25 * dv - value) / dv) * maxColour;
-    } 
-    else if (value < (vmin + 0.75 * dv)) 
-    {
-        c.r = (4 * (value - vmin - 0.5 * dv) / dv) * maxColour;
-        c.b = 0;
-    } 
-    else 
+    // With fast boot on (from retained memory after a reset, from EEPROM after a power cut), go straight back to the
+    // last colour: otherwise start off, and the greeting brings the colour back once we are connected
+    if( bootFastEnabled() && bootSavedColour(&saved, &level))
     {
-        c.g = maxColour + (4 * (vmin + 0.75 * dv - value) / dv) * maxColour;
-        c.b = 0;
+        lamp.setBrightnessLevel(level);
+        lamp.setColour(saved.r, saved.g, saved.b);
+        lamp.setRestoreColour();
     }
-
-    if( debugEnabled) {
-        Serial.printf("Red: %d\n", c.r);
-        Serial.printf("Green: %d\n", c.g);
-        Serial.printf("Blue: %d\n", c.b);
-        Serial.printf("----------\n");        
+    else
+    {
+        lamp.setColour(0, 0, 0);
     }
+    bootMilestone(BOOT_COLOUR_SHOWN);
     
-    return(c);
-}
-
- /*
- * This is a "visible spectrum" gradient
- *
- * Can be used to map an point on an input scale to a colour
- * Slightly different from the cold->hot colour gradient
- *
- * https://msdn.microsoft.com/en-us/library/mt712854.aspx
-  */
-  
-
-COLOUR Light::visibleColourFromRange(float value, float vmin, float vmax)
-{
+    RGB.onChange(ledChangeHandler);
     
-    COLOUR c;  
-    double dv;
-    int maxColour = pow(2,getColourResolution()) - 1;
-
-    if( debugEnabled) {
-        Serial.printf("----\n");
-        Serial.printf("computing colour - spectrum algorithm\n");
-        Serial.printf("Max: %d\n", maxColour);
-        Serial.printf("Value, vMin, vMax %f %f %f\n", value, vmin, vmax);
-    }
+    conn.begin();
+    seenConnections = conn.getConnections();
+    if( conn.isConnected()) bootMilestone(BOOT_CLOUD_CONNECTED);
     
-    if (value < vmin)
-        value = vmin;
-      
-    if (value > vmax)
-        value = vmax;
-      
-    dv = vmax - vmin;
-
-    if (value < (vmin + 0.25 * dv)) {
-        c.r = maxColour - ((4 * (value - vmin) / dv) * maxColour);
-        c.g = 0;
-        c.b = maxColour;
-    } 
-    else if (value < (vmin + 0.5 * dv)) 
-    {
-        c.r = 0;
-        c.g = (4 * (value - vmin - 0.25 * dv) / dv) * maxColour;
-        c.b = maxColour + (4 * (vmin + 0.25 * dv - value) / dv) * maxColour;
-    } 
-    else if (value < (vmin + 0.75 * dv)) 
-    {
-        c.r = (4 * (value - vmin - 0.5 * dv) / dv) * maxColour;
-        c.g = maxColour;
-        c.b = 0;
-    } 
-    else 
-    {
-        c.r = maxColour;
-        c.g = maxColour + (4 * (vmin + 0.75 * dv - value) / dv) * maxColour;
-        c.b = 0;
-    }
-
-    if( debugEnabled) {
-        Serial.printf("Red: %d\n", c.r);
-        Serial.printf("Green: %d\n", c.g);
-        Serial.printf("Blue: %d\n", c.b);
-        Serial.printf("----------\n");        
-    }
+    Particle.function("colour", LampControl);
+    Particle.function("pulse",  PulseLamp);
+    Particle.function("admin",  AdminHandler);
     
-    return(c);
-}
-
-// Rapidly cycle the Lamp through the colour spectrum: a sort of "hello" message
-// Does this after connecting and before powering down the lamp and waiting for a command
-void Light::rapidColourRamp(void)
-{
-    float value;
-    COLOUR colour;
+    Particle.variable("red",   redLevel);
+    Particle.variable("green", greenLevel);
+    Particle.variable("blue",  blueLevel);
+    Particle.variable("level", powerLevel);
+    Particle.variable("bits",  bitsPerPixel);
+    Particle.variable("queued", sequenceLength);
+    Particle.variable("pulseticks", pulseTicks);
+    Particle.variable("pulsechanges", pulseChanges);
+    Particle.variable("boot", bootReport);
+#if LAMP_PROFILE
+    Particle.variable("profile", profileReport);
+#endif
+    Particle.variable("connection", connectionReport);
+    Particle.variable("lan", lanReport);
+    Particle.variable("stream", streamReport);
+    Particle.variable("state", stateReport);
+    stateUpdateReport();
     
-    for( value = 0; value < 1024; delay(10), value++)
-    {
-        colour = colourRampFromRange(value,0,1024);
-        setColour(colour.r, colour.g, colour.b);
-    }
+    bootMilestone(BOOT_FUNCTIONS_REGISTERED);
 }
 
-void Light::setRestoreColour(void)
+void loop()
 {
-    savedColour = currentColour;    
-}
-
-// Exposed Lamp control command
-int LampControl(String command)
-{
-    int numArgs;
-    int retVal = -1;
-    
-    command.trim();
-    command.toUpperCase();
-    
-    String lampCommand[8];
-    numArgs = splitStringToArray(command, lampCommand);
+    // Debug trace out to the serial port, as it has room
+    traceDrain();
     
-    if( debugEnabled) {
-        Serial.printf("Colour command received: ");
-        
-        for( int i=0; i < numArgs; i++) {
-            Serial.printf("%s ",lampCommand[i].c_str());
-        }
-        Serial.printf("\n");
-    }
-    
-    String action = lampCommand[0];
+    // Commands and colour streams from the local network, when those are turned on
+    lanServer.poll();
+    colourStream.poll();
     
-    // Now just hand off to the handlers
-    // However we have to remembed the colour, so that we can reset it
+    // Keep the connection and profile variables reasonably fresh, without formatting them on every call
+    static uint32_t lastReport = 0;
     
-    if( action == "SET")
-    {
-        retVal = SetLampColour(lampCommand[1], lampCommand[2], lampCommand[3]);
-        lamp.setRestoreColour();
-    }
-    else if (action == "RAMP")
-    {
-        retVal = SetLampColourFromRamp(lampCommand[1], lampCommand[2], lampCommand[3]);
-        lamp.setRestoreColour();
-    }
-    else if (action == "SPECTRUM")
-    {
-        retVal = SetLampColourFromSpectrum( lampCommand[1], lampCommand[2], lampCommand[3] );
-        lamp.setRestoreColour();
-    }
-    else if (action == "LEVEL")
-    {
-        retVal = SetLampMaximumBrightness(lampCommand[1], lampCommand[2]);
-    }
-    else
+    if( millis() - lastReport >= 1000)
     {
-        if (debugEnabled)
-        {
-            Serial.printf("That is not a valid command. Ignored");
-        }
+        conn.updateReport();
+        lanServer.updateReport();
+        colourStream.updateReport();
+#if LAMP_PROFILE
+        profileUpdateReport();
+#endif
+        lastReport = millis();
     }
-
-
-    return retVal;
-}
-
-int SetLampColour(String arg1, String arg2, String arg3)
-{
-    uint32_t r, g, b;
     
-    int retval = -1;
-    if( arg1 == "RED")
-    {
-        r = arg2.toInt();
-        lamp.setRed(r);
-        retval = r;
-    }
-    else if (arg1 == "GREEN")
-    {
-        g = arg2.toInt();
-        lamp.setGreen(g);
-        retval = g;
-    }
-    else if (arg1 == "BLUE")
-    {
-        b = arg2.toInt();
-        lamp.setBlue(b);
-        retval = b;
-    }
-    else
-    {
-        // Assume that the three arguments are R, G, B integer values
-        // If the values are not valid, we just get 0 
-        r = arg1.toInt();
-        g = arg2.toInt();
-        b = arg3.toInt();
-        lamp.setColour(r,g,b);
-        retval = 0;
-    }
-
-    return retval;    
-}
-
-// Set the maximum brightness level (for Alexa dimming)
-int SetLampMaximumBrightness(String arg1, String arg2)
-{
-    int retval = 0;
-    int level, dim;
+    // Tell subscribers about the lamp's state, once it has settled, and keep the state variable in step with it
+    statePublisher.poll();
+    stateUpdateReport();
     
-    if( arg1 == "SET")
+    // Save the settings once they have settled, for after a power cut
+    settingsStore.poll();
+    
+    // The connection follows the system's events: here we just see what has changed since last time
+    if( conn.getConnections() != seenConnections)
     {
-        level = arg2.toInt();
-        lamp.setBrightnessLevel(level);
+        seenConnections = conn.getConnections();
+        
+        bootMilestone(BOOT_CLOUD_CONNECTED);
+        
+        // Let the user know we are connected (unless we're in a hurry). This plays from a timer, so we carry on straight away
+        if( !bootFastEnabled()) greeting.start();
     }
-    else if (arg1 == "DIM")
+    else if( conn.getCloudRecoveryState() == CONNECTING && conn.mSecSinceLastStateChange() > LISTEN_TIMEOUT_MS)
     {
-        dim = arg2.toInt();
-        level = lamp.getBrightnessLevel();
-        level += dim;
-        lamp.setBrightnessLevel(level);
+        // Couldn't get to any of the stored networks: let the user give us new credentials
+        conn.setCloudRecoveryState(LISTENING);
+        WiFi.listen();
     }
-    else
-    {
-        // Just assume it is a straight set command
-        level = arg1.toInt();
-        lamp.setBrightnessLevel(level);        
-    }
-    
-    // Reset the colour based on this dimming level
-    lamp.restoreColour();
-    
-    return retval;
-    
-}
-// Just use integers for colour values and range passed in ... 
-int SetLampColourFromRamp(String arg1, String arg2, String arg3)
-{
-    float v, vmin, vmax;
-    
-    v = (float)arg1.toInt();
-    vmin = (float)arg2.toInt();
-    vmax = (float)arg3.toInt();
-    
-    COLOUR col = lamp.colourRampFromRange(v, vmin, vmax);
-    
-    lamp.setColour(col.r, col.g, col.b);
-    
-    return 0;
-    
-}
-
-
-int SetLampColourFromSpectrum(String arg1, String arg2, String arg3)
-{
-    float v, vmin, vmax;
-    
-    v = (float)arg1.toInt();
-    vmin = (float)arg2.toInt();
-    vmax = (float)arg3.toInt();
-    
-    COLOUR col = lamp.visibleColourFromRange(v, vmin, vmax);
-    
-    lamp.setColour(col.r, col.g, col.b);
-    
-    return 0;    
 }
@@ -0,0 +1,213 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "palette.h"
+#include "admin.h"
+
+#include <stdlib.h>
+
+PaletteRegistry palettes;
+
+PaletteRegistry::PaletteRegistry(void) : maxColour(255)
+{
+    for( int id = 0; id < MAX_PALETTES; id++)
+    {
+        clear(id);
+    }
+}
+
+int PaletteRegistry::clear(int id)
+{
+    if( id < 0 || id >= MAX_PALETTES) return -1;
+    
+    pool[id].numStops = 0;
+    pool[id].complete = false;
+    
+    return 0;
+}
+
+// Stops are added in order of position (in percent along the palette): the first has to be at 0%
+// Two stops at the same position make a hard edge. The palette is complete when a stop is added at 100%
+int PaletteRegistry::addStop(int id, int percent, uint8_t r, uint8_t g, uint8_t b)
+{
+    if( id < 0 || id >= MAX_PALETTES) return -1;
+    
+    PALETTE &palette = pool[id];
+    
+    if( palette.complete || palette.numStops >= MAX_PALETTE_STOPS) return -1;
+    if( percent < 0 || percent > 100) return -1;
+    
+    uint16_t position = (percent * GRADIENT_END) / 100;
+    
+    if( palette.numStops == 0 && position != 0) return -1;
+    if( palette.numStops > 0 && position < palette.stops[palette.numStops - 1].position) return -1;
+    
+    GRADIENT_STOP &stop = palette.stops[palette.numStops++];
+    
+    stop.position = position;
+    stop.r = r;
+    stop.g = g;
+    stop.b = b;
+    
+    if( position == GRADIENT_END)
+    {
+        palette.gradient.setStops(palette.stops, palette.numStops);
+        palette.gradient.build(maxColour);
+        palette.complete = true;
+    }
+    
+    return palette.numStops;
+}
+
+int PaletteRegistry::getNumStops(int id)
+{
+    return id >= 0 && id < MAX_PALETTES ? pool[id].numStops : 0;
+}
+
+// Back to the first numStops stops, to undo a PALETTE ADD that failed part way: incomplete again if that drops the last
+void PaletteRegistry::truncate(int id, int numStops)
+{
+    if( id < 0 || id >= MAX_PALETTES || numStops < 0 || numStops >= pool[id].numStops) return;
+    
+    pool[id].numStops = numStops;
+    pool[id].complete = false;
+}
+
+bool PaletteRegistry::isComplete(int id)
+{
+    return id >= 0 && id < MAX_PALETTES && pool[id].complete;
+}
+
+// Rebake all the complete palettes for a new colour resolution
+void PaletteRegistry::build(uint32_t newMaxColour)
+{
+    maxColour = newMaxColour;
+    
+    for( int id = 0; id < MAX_PALETTES; id++)
+    {
+        if( pool[id].complete) pool[id].gradient.build(maxColour);
+    }
+}
+
+// Check isComplete() first: an incomplete palette gives black
+COLOUR PaletteRegistry::colourFromRange(int id, int32_t value, int32_t minValue, int32_t maxValue)
+{
+    if( !isComplete(id))
+    {
+        COLOUR off = { 0, 0, 0 };
+        return off;
+    }
+    
+    return pool[id].gradient.colourFromRange(value, minValue, maxValue);
+}
+
+// Parse a stop given as <percent>:<RRGGBB>, e.g. 50:00FF00
+static bool parsePaletteStop(const char *arg, int *percent, uint8_t *r, uint8_t *g, uint8_t *b)
+{
+    char *end;
+    
+    *percent = strtol(arg, &end, 10);
+    if( end == arg || *end != ':') return false;
+    
+    const char *hex = end + 1;
+    uint32_t rgb = strtoul(hex, &end, 16);
+    if( end - hex != 6 || *end != '\0') return false;
+    
+    *r = (rgb >> 16) & 0xFF;
+    *g = (rgb >> 8) & 0xFF;
+    *b = rgb & 0xFF;
+    
+    return true;
+}
+
+/*
+ * PALETTE <id> val vMin vMax               set the colour from a palette, like RAMP and SPECTRUM
+ * PALETTE <id> CLEAR                       forget a palette
+ * PALETTE <id> ADD <pc>:<RRGGBB> ...       add stops to a palette: all of them, or (if any is bad) none
+ */
+int SetLampPalette(const CommandLine &command)
+{
+    int id = command.toInt(1);
+    
+    if( command.token(1).length == 0 || id < 0 || id >= MAX_PALETTES)
+    {
+        return -1;
+    }
+    
+    KEYWORD action = command.keyword(2);
+    
+    if( action == KW_CLEAR)
+    {
+        return palettes.clear(id);
+    }
+    
+    if( action == KW_ADD)
+    {
+        int retval = -1;
+        int before = palettes.getNumStops(id);
+        
+        for( int i = 3; i < command.count(); i++)
+        {
+            int percent;
+            uint8_t r, g, b;
+            
+            if( !parsePaletteStop(command.text(i), &percent, &r, &g, &b))
+            {
+                retval = -1;
+            }
+            else
+            {
+                retval = palettes.addStop(id, percent, r, g, b);
+            }
+            
+            // Leave the palette as it was, so the command can be sent again once it's put right
+            if( retval < 0)
+            {
+                palettes.truncate(id, before);
+                return retval;
+            }
+        }
+        
+        return retval;
+    }
+    
+    if( !palettes.isComplete(id))
+    {
+        return -1;
+    }
+    
+    COLOUR col = palettes.colourFromRange(id, command.toInt(2), command.toInt(3), command.toInt(4));
+    
+    colourFade.stop();
+    sequencer.stop();
+    
+    lamp.setColour(col.r, col.g, col.b);
+    
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef palette_h
+#define palette_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "light.h"
+#include "gradient.h"
+
+// A fixed pool of user defined gradients: no heap allocation
+#define MAX_PALETTES        4
+#define MAX_PALETTE_STOPS   8
+
+int SetLampPalette(const CommandLine &command);
+
+/*
+ * User defined colour gradients ("palettes"), uploaded a few stops at a time with PALETTE <id> ADD
+ *
+ * Each palette is baked into a gradient table just like RAMP and SPECTRUM, once it is complete
+ * (its stops run from 0% to 100%), and rebaked when the colour resolution changes
+ */
+class PaletteRegistry
+{
+    public:
+        PaletteRegistry(void);
+        
+        int    clear(int id);
+        int    addStop(int id, int percent, uint8_t r, uint8_t g, uint8_t b);
+        int    getNumStops(int id);
+        void   truncate(int id, int numStops);
+        bool   isComplete(int id);
+        
+        void   build(uint32_t maxColour);
+        COLOUR colourFromRange(int id, int32_t value, int32_t minValue, int32_t maxValue);
+        
+    private:
+        typedef struct
+        {
+            GRADIENT_STOP  stops[MAX_PALETTE_STOPS];
+            int            numStops;
+            bool           complete;
+            ColourGradient gradient;
+        } PALETTE;
+        
+        PALETTE  pool[MAX_PALETTES];
+        uint32_t maxColour;
+};
+
+extern PaletteRegistry palettes;
+
+#endif
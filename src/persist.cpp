@@ -0,0 +1,217 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "persist.h"
+#include "admin.h"
+#include "boot.h"
+#include "frame.h"
+#include "stream.h"
+
+#include <stddef.h>
+#include <string.h>
+
+SettingsStore::SettingsStore(void)
+{
+    memset(&candidate, 0, sizeof(candidate));
+    memset(&saved, 0, sizeof(saved));
+    haveSaved = false;
+    nextSlot = 0;
+    changedAt = 0;
+    lastWrite = 0;
+    resumePulse = false;
+    
+    changes = 0;
+    writes = 0;
+}
+
+static int slotAddress(int slot)
+{
+    return PERSIST_BASE + slot * sizeof(PERSIST_RECORD);
+}
+
+bool SettingsStore::validRecord(const PERSIST_RECORD &record)
+{
+    return record.version >= 1 && record.version <= PERSIST_VERSION && record.sequence != 0 && record.sequence != 0xFFFFFFFF &&
+           record.crc == frameCrc8((const uint8_t *)&record, offsetof(PERSIST_RECORD, crc));
+}
+
+bool SettingsStore::begin(void)
+{
+    PERSIST_RECORD record;
+    
+    haveSaved = false;
+    nextSlot = 0;
+    
+    for( int slot = 0; slot < PERSIST_SLOTS; slot++)
+    {
+        EEPROM.get(slotAddress(slot), record);
+        
+        if( validRecord(record) && (!haveSaved || record.sequence > saved.sequence))
+        {
+            saved = record;
+            haveSaved = true;
+            nextSlot = (slot + 1) % PERSIST_SLOTS;
+        }
+    }
+    
+    // Nothing has changed yet: the first save waits for a change, and then only for it to settle
+    if( haveSaved) candidate = saved;
+    changedAt = millis();
+    lastWrite = millis() - PERSIST_MIN_INTERVAL_MS;
+    resumePulse = false;
+    
+    return haveSaved;
+}
+
+int SettingsStore::getColourResolution(int defaultBits)
+{
+    return haveSaved && saved.bits >= 8 && saved.bits <= 16 ? saved.bits : defaultBits;
+}
+
+void SettingsStore::restore(void)
+{
+    if( !haveSaved) return;
+    
+    COLOUR colour;
+    int level;
+    
+    // Retained memory was lost (a power cut): the saved fast boot setting decides whether setup() shows the colour
+    if( !bootSavedColour(&colour, &level))
+    {
+        colour.r = saved.red;
+        colour.g = saved.green;
+        colour.b = saved.blue;
+        level = saved.level;
+        
+        bootSetFast(saved.flags & PERSIST_FAST_BOOT ? KW_ON : KW_OFF);
+    }
+    
+    lamp.setBrightnessLevel(level);
+    lamp.setRestoreColour(colour);
+    
+    // Same limits as the PULSE commands
+    if( saved.pulsePeriodMs >= 500 && saved.pulsePeriodMs <= 1000000) lightPulse.setPeriod(saved.pulsePeriodMs);
+    if( (saved.pulse & ~PERSIST_PULSE_ON) < NUM_WAVEFORMS) lightPulse.setWaveform((WAVEFORM)(saved.pulse & ~PERSIST_PULSE_ON));
+    
+    resumePulse = saved.pulse & PERSIST_PULSE_ON;
+}
+
+void SettingsStore::readSettings(PERSIST_RECORD *record)
+{
+    COLOUR c = lamp.getRestoreColour();
+    
+    memset(record, 0, sizeof(*record));
+    record->red = c.r;
+    record->green = c.g;
+    record->blue = c.b;
+    record->level = lamp.getBrightnessLevel();
+    record->bits = lamp.getColourResolution();
+    record->pulse = lightPulse.getWaveform() | (lightPulse.isPulsing() ? PERSIST_PULSE_ON : 0);
+    record->pulsePeriodMs = lightPulse.getPeriod();
+    record->flags = bootFastEnabled() ? PERSIST_FAST_BOOT : 0;
+}
+
+bool SettingsStore::sameSettings(const PERSIST_RECORD &a, const PERSIST_RECORD &b)
+{
+    return a.red == b.red && a.green == b.green && a.blue == b.blue && a.level == b.level && a.bits == b.bits &&
+           a.pulse == b.pulse && a.pulsePeriodMs == b.pulsePeriodMs && a.flags == b.flags;
+}
+
+void SettingsStore::write(void)
+{
+    PERSIST_RECORD record = candidate;
+    
+    record.sequence = haveSaved ? saved.sequence + 1 : 1;
+    record.version = PERSIST_VERSION;
+    record.crc = frameCrc8((const uint8_t *)&record, offsetof(PERSIST_RECORD, crc));
+    
+    EEPROM.put(slotAddress(nextSlot), record);
+    
+    saved = record;
+    haveSaved = true;
+    nextSlot = (nextSlot + 1) % PERSIST_SLOTS;
+    lastWrite = millis();
+    writes++;
+}
+
+void SettingsStore::poll(void)
+{
+    uint32_t now = millis();
+    
+    // Pulsing again waits for the lamp to show its colour: straight away with fast boot, otherwise after the greeting.
+    // A command before then decides for itself. Until it's settled, don't save the pulse as off
+    if( resumePulse)
+    {
+        if( bootReached(BOOT_FIRST_COMMAND))
+        {
+            resumePulse = false;
+        }
+        else if( bootFastEnabled() || bootReached(BOOT_GREETING_DONE))
+        {
+            lightPulse.enablePulse(true);
+            resumePulse = false;
+        }
+        else
+        {
+            return;
+        }
+    }
+    
+    if( colourStream.isActive()) return;
+    
+    PERSIST_RECORD current;
+    
+    readSettings(&current);
+    
+    if( !sameSettings(current, candidate))
+    {
+        candidate = current;
+        changedAt = now;
+        changes++;
+    }
+    
+    if( now - changedAt < PERSIST_SETTLE_MS) return;
+    
+    if( haveSaved && sameSettings(candidate, saved)) return;
+    
+    if( now - lastWrite < PERSIST_MIN_INTERVAL_MS) return;
+    
+    write();
+}
+
+uint32_t SettingsStore::getChanges(void)
+{
+    return changes;
+}
+
+uint32_t SettingsStore::getWrites(void)
+{
+    return writes;
+}
@@ -0,0 +1,120 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef persist_h
+#define persist_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+
+/*
+ * Keeps the lamp's settings in EEPROM, so it comes back from a power cut as it was rather than off and at full level:
+ * the colour it goes back to, the brightness level, the colour resolution, the pulse (on or off, period and
+ * waveform) and the fast boot setting. Retained memory only survives a power cut with a backup battery, so without
+ * the fast boot setting here the lamp would wait for the cloud before showing its colour
+ *
+ * The EEPROM holds a ring of PERSIST_SLOTS fixed size records. Each save goes in the slot after the newest, with
+ * the next sequence number and a CRC, so the writes are spread over all the slots and the newest record is never
+ * overwritten: if the power goes mid-write, the damaged record fails its CRC and the one before it is used.
+ * On boot the newest valid record (highest sequence number) wins
+ *
+ * Settings are only saved once they have held for PERSIST_SETTLE_MS, so a burst of SET or DIM commands is one write,
+ * for where they end up, and no more often than every PERSIST_MIN_INTERVAL_MS. A state that is already saved
+ * is not written again. While a colour stream (stream.h) is driving the lamp nothing is saved: it stopped the
+ * pulse, and puts it back when it ends
+ */
+#define PERSIST_BASE            0           // EEPROM address of the first slot
+#define PERSIST_SLOTS           64
+#define PERSIST_VERSION         2           // 2 added flags: version 1 records (flags 0) are still read
+#define PERSIST_SETTLE_MS       2000
+#define PERSIST_MIN_INTERVAL_MS 10000
+
+#define PERSIST_PULSE_ON        0x80        // In pulse: the rest is the waveform
+#define PERSIST_FAST_BOOT       0x01        // In flags
+
+typedef struct
+{
+    uint32_t sequence;          // 1 up: 0xFFFFFFFF is erased EEPROM
+    uint32_t pulsePeriodMs;
+    uint16_t red;
+    uint16_t green;
+    uint16_t blue;
+    uint8_t  level;
+    uint8_t  bits;
+    uint8_t  pulse;
+    uint8_t  version;
+    uint8_t  flags;
+    uint8_t  crc;               // frameCrc8() of everything before it
+} PERSIST_RECORD;
+
+class SettingsStore
+{
+    public:
+        SettingsStore(void);
+        
+        // Call from setup(), before anything else: finds the newest saved record. Returns false if there isn't one
+        bool begin(void);
+        
+        // The saved colour resolution, or the default if nothing was saved
+        int  getColourResolution(int defaultBits);
+        
+        // Call from setup() once the PWM is set up: puts back the level, the colour to go back to, the pulse
+        // settings and the fast boot setting. Retained memory wins, as it survived a reset and is newer
+        void restore(void);
+        
+        // Call from loop()
+        void poll(void);
+        
+        // Changes seen, and how many records have been written for them
+        uint32_t getChanges(void);
+        uint32_t getWrites(void);
+        
+    private:
+        void readSettings(PERSIST_RECORD *record);
+        bool sameSettings(const PERSIST_RECORD &a, const PERSIST_RECORD &b);
+        bool validRecord(const PERSIST_RECORD &record);
+        void write(void);
+        
+        PERSIST_RECORD candidate;       // The latest settings, waiting to settle
+        PERSIST_RECORD saved;           // The newest record in EEPROM
+        bool     haveSaved;
+        int      nextSlot;
+        uint32_t changedAt;             // millis() when candidate last changed
+        uint32_t lastWrite;
+        bool     resumePulse;           // The lamp was pulsing: start again once it is showing its colour
+        
+        uint32_t changes;
+        uint32_t writes;
+};
+
+extern SettingsStore settingsStore;
+
+#endif
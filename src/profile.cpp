@@ -0,0 +1,144 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "profile.h"
+
+#if LAMP_PROFILE
+
+#include <stdio.h>
+#include <string.h>
+
+PROFILE_HISTOGRAM profiles[NUM_PROFILE_SCOPES];
+
+char profileReport[PROFILE_REPORT_LENGTH];
+
+static const char *profileNames[NUM_PROFILE_SCOPES] = {
+    "colour", "pulse", "admin", "setColour", "pulseTick", "fadeTick", "seqTick", "lan", "pulseJitter", "fadeJitter", "seqJitter"
+};
+
+static bool isJitterScope(int id)
+{
+    return id >= PROFILE_PULSE_JITTER;
+}
+
+// Convert to microseconds: jitter is already in them
+static uint32_t profileMicros(int id, uint32_t value)
+{
+    return isJitterScope(id) ? value : value / System.ticksPerMicrosecond();
+}
+
+// The upper bound of the bucket holding the given fraction (per thousand) of the calls
+static uint32_t profilePercentile(int id, uint32_t perMille)
+{
+    const PROFILE_HISTOGRAM &h = profiles[id];
+    uint32_t target = ((uint64_t)h.count * perMille + 999) / 1000;
+    uint32_t seen = 0;
+    
+    for( int b = 0; b < PROFILE_BUCKETS; b++)
+    {
+        seen += h.buckets[b];
+        
+        if( seen >= target)
+        {
+            // Bucket b holds values below 2^b: the last bucket is open ended, so use the maximum
+            return b == PROFILE_BUCKETS - 1 ? h.max : (1UL << b) - 1;
+        }
+    }
+    
+    return h.max;
+}
+
+void profileUpdateReport(void)
+{
+    int n = 0;
+    
+    profileReport[0] = '\0';
+    
+    for( int i = 0; i < NUM_PROFILE_SCOPES && n < (int)sizeof(profileReport); i++)
+    {
+        if( profiles[i].count == 0) continue;
+        
+        n += snprintf(profileReport + n, sizeof(profileReport) - n, "%s%s %lu %lu %lu %lu", n ? ";" : "", profileNames[i],
+                      (unsigned long)profiles[i].count,
+                      (unsigned long)profileMicros(i, profilePercentile(i, 500)),
+                      (unsigned long)profileMicros(i, profilePercentile(i, 990)),
+                      (unsigned long)profileMicros(i, profiles[i].max));
+    }
+}
+
+// The full histograms, to the serial port
+void profilePrint(void)
+{
+    Serial.printf("Profile: %lu ticks per us\n", (unsigned long)System.ticksPerMicrosecond());
+    
+    for( int i = 0; i < NUM_PROFILE_SCOPES; i++)
+    {
+        const PROFILE_HISTOGRAM &h = profiles[i];
+        
+        if( h.count == 0) continue;
+        
+        Serial.printf("%s: %lu calls, max %lu %s\n", profileNames[i], (unsigned long)h.count, (unsigned long)h.max, isJitterScope(i) ? "us" : "ticks");
+        
+        for( int b = 0; b < PROFILE_BUCKETS; b++)
+        {
+            if( h.buckets[b])
+            {
+                Serial.printf("  < 2^%-2d %lu\n", b, (unsigned long)h.buckets[b]);
+            }
+        }
+    }
+}
+
+void profileClear(void)
+{
+    memset(profiles, 0, sizeof(profiles));
+    profileUpdateReport();
+}
+
+// PROFILE (print the histograms to serial), or PROFILE CLEAR
+int ProfileCommand(const CommandLine &command)
+{
+    switch( command.keyword(1))
+    {
+        case KW_NONE:
+            profileUpdateReport();
+            profilePrint();
+            return 0;
+            
+        case KW_CLEAR:
+            profileClear();
+            return 0;
+            
+        default:
+            return -1;
+    }
+}
+
+#endif
@@ -0,0 +1,140 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef profile_h
+#define profile_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "command.h"
+
+/*
+ * Latency histograms for the command handlers and timer callbacks
+ *
+ * Each scope counts its calls into log2 buckets of System.ticks() (the DWT cycle counter on the Photon):
+ * bucket n holds calls which took 2^(n-1) to 2^n - 1 ticks. Timer jitter is measured the same way, in
+ * microseconds: how far each tick was from when it was due.
+ *
+ * Build with LAMP_PROFILE 1 to enable. With it 0 (the default on the device) it compiles out entirely: the PROFILE_
+ * macros are empty, and there are no histograms, report, PROFILE admin command or profile variable
+ */
+#ifndef LAMP_PROFILE
+#define LAMP_PROFILE    0
+#endif
+
+#define PROFILE_BUCKETS         24      // The last bucket collects anything longer
+#define PROFILE_REPORT_LENGTH   600
+
+typedef enum
+{
+    PROFILE_LAMP_CONTROL = 0,
+    PROFILE_PULSE_LAMP,
+    PROFILE_ADMIN,
+    PROFILE_SET_COLOUR,
+    PROFILE_PULSE_TICK,
+    PROFILE_FADE_TICK,
+    PROFILE_SEQUENCE_TICK,
+    PROFILE_LAN_REQUEST,                // A request to the LAN server, from parsing it to its response being ready
+    PROFILE_PULSE_JITTER,               // Jitter scopes are in microseconds, not ticks
+    PROFILE_FADE_JITTER,
+    PROFILE_SEQUENCE_JITTER,
+    NUM_PROFILE_SCOPES
+} PROFILE_ID;
+
+#if LAMP_PROFILE
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t max;
+    uint32_t buckets[PROFILE_BUCKETS];
+    uint32_t lastTick;                  // Jitter scopes: micros() at the last tick, 0 after a restart
+} PROFILE_HISTOGRAM;
+
+extern PROFILE_HISTOGRAM profiles[NUM_PROFILE_SCOPES];
+
+// Per scope "name count p50 p99 max" (in microseconds), exposed to the cloud: refreshed by profileUpdateReport()
+extern char profileReport[PROFILE_REPORT_LENGTH];
+
+int  ProfileCommand(const CommandLine &command);
+void profileUpdateReport(void);
+void profilePrint(void);
+void profileClear(void);
+
+inline void profileRecord(PROFILE_ID id, uint32_t value)
+{
+    PROFILE_HISTOGRAM &h = profiles[id];
+    
+    uint32_t bucket = value ? 32 - __builtin_clz(value) : 0;
+    if( bucket >= PROFILE_BUCKETS) bucket = PROFILE_BUCKETS - 1;
+    
+    h.buckets[bucket]++;
+    h.count++;
+    if( value > h.max) h.max = value;
+}
+
+// A timer tick which was due periodUs after the last one: record how far out it was
+inline void profileInterval(PROFILE_ID id, uint32_t periodUs)
+{
+    uint32_t now = micros();
+    PROFILE_HISTOGRAM &h = profiles[id];
+    
+    if( h.lastTick)
+    {
+        int32_t late = (int32_t)(now - h.lastTick - periodUs);
+        profileRecord(id, late < 0 ? -late : late);
+    }
+    
+    h.lastTick = now ? now : 1;
+}
+
+// Times the rest of the enclosing block
+class ProfileScope
+{
+    public:
+        ProfileScope(PROFILE_ID id) : id(id), start(System.ticks()) {}
+        ~ProfileScope() { profileRecord(id, System.ticks() - start); }
+        
+    private:
+        PROFILE_ID id;
+        uint32_t   start;
+};
+
+#define PROFILE_SCOPE(id)               ProfileScope profileScope_(id)
+#define PROFILE_INTERVAL(id, periodUs)  profileInterval(id, periodUs)
+#define PROFILE_RESTART(id)             (profiles[id].lastTick = 0)
+#else
+#define PROFILE_SCOPE(id)
+#define PROFILE_INTERVAL(id, periodUs)
+#define PROFILE_RESTART(id)
+#endif
+
+#endif
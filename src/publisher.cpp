@@ -0,0 +1,126 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "publisher.h"
+#include "wifi-setup.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Only the fields in the event: a fade or the cloud coming and going is not news to subscribers
+static bool sameState(const LAMP_STATE &a, const LAMP_STATE &b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.level == b.level && a.bits == b.bits && a.pulse == b.pulse;
+}
+
+StatePublisher::StatePublisher(void)
+{
+    memset(&candidate, 0, sizeof(candidate));
+    published = candidate;
+    changedAt = 0;
+    havePublished = false;
+    seenConnections = 0;
+    
+    tokens = PUBLISH_BURST;
+    lastRefill = 0;
+    
+    changes = 0;
+    publishes = 0;
+}
+
+// One token back every PUBLISH_INTERVAL_MS, up to PUBLISH_BURST
+void StatePublisher::refill(uint32_t now)
+{
+    while( tokens < PUBLISH_BURST && now - lastRefill >= PUBLISH_INTERVAL_MS)
+    {
+        tokens++;
+        lastRefill += PUBLISH_INTERVAL_MS;
+    }
+    
+    if( tokens == PUBLISH_BURST) lastRefill = now;
+}
+
+void StatePublisher::poll(void)
+{
+    uint32_t now = millis();
+    LAMP_STATE current;
+    
+    readLampState(&current);
+    
+    if( !sameState(current, candidate))
+    {
+        candidate = current;
+        changedAt = now;
+        changes++;
+    }
+    
+    refill(now);
+    
+    if( !Particle.connected() || now - changedAt < PUBLISH_SETTLE_MS) return;
+    
+    // Subscribers may have missed changes while we were away: tell them again after each reconnection
+    bool reconnected = conn.getConnections() != seenConnections;
+    
+    if( havePublished && !reconnected && sameState(candidate, published)) return;
+    
+    if( tokens == 0) return;
+    
+    char data[PUBLISH_DATA_LENGTH];
+    snprintf(data, sizeof(data), "{\"r\":%lu,\"g\":%lu,\"b\":%lu,\"level\":%d,\"bits\":%d,\"pulse\":%d}",
+             (unsigned long)candidate.r, (unsigned long)candidate.g, (unsigned long)candidate.b,
+             candidate.level, candidate.bits, candidate.pulse ? 1 : 0);
+    
+    // A failed publish costs its token too, and the rest of the burst: publish() can block, so the next try waits
+    // PUBLISH_INTERVAL_MS rather than coming round on every loop
+    tokens--;
+    
+    if( !Particle.publish(PUBLISH_EVENT, data, 60, PRIVATE))
+    {
+        tokens = 0;
+        lastRefill = now;
+    }
+    else
+    {
+        published = candidate;
+        havePublished = true;
+        seenConnections = conn.getConnections();
+        publishes++;
+    }
+}
+
+uint32_t StatePublisher::getChanges(void)
+{
+    return changes;
+}
+
+uint32_t StatePublisher::getPublished(void)
+{
+    return publishes;
+}
@@ -0,0 +1,88 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef publisher_h
+#define publisher_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "state.h"
+
+/*
+ * Publishes the lamp's state as an event when it changes, so integrations can subscribe rather than poll
+ * the colour and level variables
+ *
+ * A change is only published once the state has held for PUBLISH_SETTLE_MS, so a fade or a burst of commands
+ * becomes one event for where it ends up; while pulsing, the state is the colour being pulsed, not each step.
+ * Events are spent from a token bucket (PUBLISH_BURST, refilled one every PUBLISH_INTERVAL_MS) to stay inside
+ * the cloud's publish limit: a change waiting on a token is replaced by any later one. A publish that fails
+ * empties the bucket, so it is tried again at most once every PUBLISH_INTERVAL_MS. Each time the cloud
+ * comes back, the state is published again
+ *
+ * The event is PUBLISH_EVENT, private, with data {"r":R,"g":G,"b":B,"level":L,"bits":N,"pulse":0|1}
+ */
+#define PUBLISH_EVENT           "lamp/state"
+#define PUBLISH_SETTLE_MS       500
+#define PUBLISH_BURST           4
+#define PUBLISH_INTERVAL_MS     1000
+#define PUBLISH_DATA_LENGTH     96
+
+class StatePublisher
+{
+    public:
+        StatePublisher(void);
+        
+        // Call from loop()
+        void poll(void);
+        
+        // States seen, and how many of them were published: the rest were coalesced into later ones
+        uint32_t getChanges(void);
+        uint32_t getPublished(void);
+        
+    private:
+        void refill(uint32_t now);
+        
+        LAMP_STATE candidate;           // The latest state, waiting to settle
+        LAMP_STATE published;
+        uint32_t   changedAt;           // millis() when candidate last changed
+        bool       havePublished;
+        uint32_t   seenConnections;
+        
+        uint8_t    tokens;
+        uint32_t   lastRefill;
+        
+        uint32_t   changes;
+        uint32_t   publishes;
+};
+
+extern StatePublisher statePublisher;
+
+#endif
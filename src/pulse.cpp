@@ -30,33 +30,177 @@
 
 #include "pulse.h"
 #include "admin.h"
+#include "boot.h"
+#include "profile.h"
+#include "trace.h"
 
-LightPulser::LightPulser(void) : pulseEnabled(false)
-{
-    // Pulse level is in percentage: 100% is fully at the selected level
-    currentLevel   = 100;
-    pulseDirection = -1;    // Decrememting in increments of 1%
-}
- 
-void LightPulser::onTimeout(void)
+#include <math.h>
+
+// One period of each waveform, from full (phase 0) down to off (half way) and back, plus the first entry again
+// at the end so we can interpolate across the wrap. Built when the pulser is constructed
+static uint16_t waveforms[NUM_WAVEFORMS][WAVEFORM_ENTRIES + 1];
+
+static void buildWaveforms(void)
 {
-    if( pulseEnabled)
+    for( int i = 0; i <= WAVEFORM_ENTRIES; i++)
     {
-        currentLevel = currentLevel + pulseDirection;
+        float x = (float)i / WAVEFORM_ENTRIES;
+        float c = cosf(2 * M_PI * x);
         
-        if( currentLevel < 0 ) currentLevel  = 0;
-        if( currentLevel > 100) currentLevel = 100;
+        // Raised cosine
+        float sine = (1 + c) / 2;
         
-        uint32_t r = (maxRedLevel * currentLevel) / 100;
-        uint32_t g = (maxGreenLevel * currentLevel) / 100;
-        uint32_t b = (maxBlueLevel * currentLevel) / 100;
+        // Straight lines down and up
+        float triangle = fabsf(1 - 2 * x);
         
-        lamp.setColour(r,g,b);
+        // exp(cos) rises and falls like breathing: a long dim rest and a short bright peak
+        float breathe = (expf(c) - 1 / M_E) / (M_E - 1 / M_E);
         
-        if( currentLevel == 0) pulseDirection = 1;
+        waveforms[WAVE_SINE][i]     = (uint16_t)(sine * 65535 + 0.5f);
+        waveforms[WAVE_TRIANGLE][i] = (uint16_t)(triangle * 65535 + 0.5f);
+        waveforms[WAVE_BREATHE][i]  = (uint16_t)(breathe * 65535 + 0.5f);
+    }
+}
+
+int pulseTicks;
+int pulseChanges;
+
+LightPulser::LightPulser(void) : phase(0), lastTick(0), tickMs(PULSE_MAX_TICK_MS), waveform(WAVE_SINE), pulseEnabled(false),
+                                 maxRedLevel(0), maxGreenLevel(0), maxBlueLevel(0)
+{
+    buildWaveforms();
+    setPeriod(DEFAULT_PULSE_PERIOD_MS);
+}
+
+// The waveform at this phase (0 - 65535), interpolating between table entries
+uint16_t LightPulser::waveLevel(uint32_t phase)
+{
+    const uint16_t *table = waveforms[waveform];
+    
+    uint32_t index = phase >> (32 - WAVEFORM_BITS);
+    int32_t  fraction = (phase >> (16 - WAVEFORM_BITS)) & 0xFFFF;
+    
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 16);
+}
+
+// The lamp colour at this phase
+COLOUR LightPulser::pulseColour(uint32_t phase)
+{
+    uint32_t level = waveLevel(phase);
+    COLOUR c;
+    
+    c.r = (maxRedLevel * level + 0x8000) >> 16;
+    c.g = (maxGreenLevel * level + 0x8000) >> 16;
+    c.b = (maxBlueLevel * level + 0x8000) >> 16;
+    
+    return c;
+}
+
+static bool sameColour(const COLOUR &a, const COLOUR &b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b;
+}
+
+// How long until the colour next changes: at least PULSE_MIN_TICK_MS, at most PULSE_MAX_TICK_MS
+// Look ahead in PULSE_MIN_TICK_MS steps, then narrow down to the millisecond (the waveform is monotonic
+// over such a short step, so the first change is between the last two steps we looked at)
+uint32_t LightPulser::msToNextChange(void)
+{
+    COLOUR now = pulseColour(phase);
+    uint32_t ms;
+    
+    for( ms = PULSE_MIN_TICK_MS; ms < PULSE_MAX_TICK_MS; ms += PULSE_MIN_TICK_MS)
+    {
+        if( !sameColour(now, pulseColour(phase + phaseAfter(ms)))) break;
+    }
+    
+    if( ms >= PULSE_MAX_TICK_MS) return PULSE_MAX_TICK_MS;
+    if( ms == PULSE_MIN_TICK_MS) return ms;
+    
+    uint32_t low = ms - PULSE_MIN_TICK_MS;      // No change yet
+    uint32_t high = ms;                         // Changed
+    
+    while( high - low > 1)
+    {
+        uint32_t mid = (low + high) / 2;
         
-        if( currentLevel == 100) pulseDirection = -1;
+        if( sameColour(now, pulseColour(phase + phaseAfter(mid)))) low = mid;
+        else high = mid;
     }
+    
+    return high;
+}
+
+uint32_t LightPulser::phaseAfter(uint32_t ms)
+{
+    return (uint32_t)((uint64_t)phasePerMs * ms);
+}
+
+// Each tick moves the phase on by the time since the last one, draws the colour, then sets the timer
+// for when the colour will next change: flat parts of the curve are slept through, steep parts get more ticks
+void LightPulser::onTimeout(void)
+{
+    if( !pulseEnabled)
+    {
+        return;
+    }
+    
+    PROFILE_SCOPE(PROFILE_PULSE_TICK);
+    PROFILE_INTERVAL(PROFILE_PULSE_JITTER, tickMs * 1000);
+    
+    uint32_t now = millis();
+    
+    phase += phaseAfter(now - lastTick);
+    lastTick = now;
+    
+    COLOUR before = lamp.getColour();
+    COLOUR c = pulseColour(phase);
+    
+    lamp.setColour(c.r, c.g, c.b);
+    
+    pulseTicks++;
+    if( !sameColour(before, lamp.getColour())) pulseChanges++;
+    
+    // Don't block: we are called from the timer thread
+    tickMs = msToNextChange();
+    fader.changePeriod(tickMs, 0);
+    
+    trace(TRACE_PULSE_TICK, c.r, c.g, c.b, tickMs);
+}
+
+void LightPulser::setPeriod(uint32_t newPeriodMs)
+{
+    periodMs = newPeriodMs;
+    phasePerMs = ((uint64_t)1 << 32) / periodMs;
+    
+    // Look again now: the colour may change sooner at the new speed
+    if( pulseEnabled) retick();
+}
+
+void LightPulser::setWaveform(WAVEFORM newWaveform)
+{
+    waveform = newWaveform;
+    
+    if( pulseEnabled) retick();
+}
+
+// Have the timer tick straight away, rather than calling onTimeout() here: it runs on the timer thread, and
+// the two would race over the phase and the lamp colour
+void LightPulser::retick(void)
+{
+    PROFILE_RESTART(PROFILE_PULSE_JITTER);
+    tickMs = 1;
+    fader.changePeriod(tickMs);
+}
+
+uint32_t LightPulser::getPeriod(void)
+{
+    return periodMs;
+}
+
+WAVEFORM LightPulser::getWaveform(void)
+{
+    return waveform;
 }
 
 // Turn on or off the fading function.
@@ -67,8 +211,8 @@ void LightPulser::enablePulse(bool newState)
 {
     if( newState == true)
     {
-        currentLevel = 100;
-        pulseDirection = -1;
+        phase = 0;
+        lastTick = millis();
         
         COLOUR col = lamp.getColour();
         
@@ -77,54 +221,72 @@ void LightPulser::enablePulse(bool newState)
         maxBlueLevel  = col.b;
         
         pulseEnabled = true;
+        
+        tickMs = msToNextChange();
+        fader.changePeriod(tickMs);
+        PROFILE_RESTART(PROFILE_PULSE_JITTER);
     }
     else
     {
         pulseEnabled = false;
+        fader.stop();
         
-        currentLevel     = 100;
-        pulseDirection = -1;
+        phase = 0;
         
         lamp.setColour(maxRedLevel, maxGreenLevel, maxBlueLevel);
     }
 }
 
+bool LightPulser::isPulsing(void)
+{
+    return pulseEnabled;
+}
+
+COLOUR LightPulser::getPeakColour(void)
+{
+    COLOUR c = { maxRedLevel, maxGreenLevel, maxBlueLevel };
+    
+    return c;
+}
+
 // Control pulsing of the light ... doesn't mix well with repeatedly setting the colour
 // you need to turn off pulse mode before changing the colour
 int PulseLamp(String command)
 {
-    int numArgs;
     int retval = -1;
     
-    command.trim();
-    command.toUpperCase();
+    PROFILE_SCOPE(PROFILE_PULSE_LAMP);
     
-    String pulseCommand[4];
-    numArgs = splitStringToArray(command, pulseCommand);
+    bootMilestone(BOOT_FIRST_COMMAND);
+    greeting.cancel();
     
-    if( debugEnabled) {
-        Serial.printf("Pulse command received: ");
-        
-        for( int i=0; i < numArgs; i++) {
-            Serial.printf("%s ",pulseCommand[i].c_str());
-        }
-        Serial.printf("\n");
-    }
+    CommandLine pulseCommand(command.c_str());
     
-    String action = pulseCommand[0];
-    if( action == "ON")
-    {
-        lightPulse.enablePulse(true);
-        retval = 0;
-    }
-    else if( action == "OFF")
-    {
-        lightPulse.enablePulse(false);
-        retval = 0;
-    }
-    else if (action == "PERIOD")
+    // A PERIOD is traced in milliseconds
+    trace(TRACE_PULSE_COMMAND, pulseCommand.keyword(0), pulseCommand.keyword(1), (int32_t)(pulseCommand.toFloat(1) * 1000));
+    
+    switch( pulseCommand.keyword(0))
     {
-        return ChangePulsePeriod(pulseCommand[1]);
+        case KW_ON:
+            lightPulse.enablePulse(true);
+            retval = 0;
+            break;
+            
+        case KW_OFF:
+            lightPulse.enablePulse(false);
+            retval = 0;
+            break;
+            
+        case KW_PERIOD:
+            retval = SetPulsePeriod(pulseCommand.toFloat(1));
+            break;
+            
+        case KW_WAVE:
+            retval = SetPulseWaveform(pulseCommand.keyword(1));
+            break;
+            
+        default:
+            break;
     }
     
     return retval;    
@@ -132,10 +294,8 @@ int PulseLamp(String command)
 
 // We allow periods from 0.5-1000 seconds: anything outside that time is not allowed
 // Except for period of 0: that turns off the pulse
-int ChangePulsePeriod(String command)
+int SetPulsePeriod(float newPeriod)
 {
-    float newPeriod = command.toFloat();
-    
     if( newPeriod < 0 || newPeriod > 1000 )
     {
         // Reject, do nothing
@@ -151,8 +311,22 @@ int ChangePulsePeriod(String command)
     {
         if( newPeriod < 0.5) newPeriod = 0.5;
         
-        // Anything else: compute the new interval. Since we pulse in 1% intervals, this is just 10 x number of seconds to give is mSec
-        fader.changePeriod( (int)(10 * newPeriod));
+        // The tick rate stays the same: only the step through the waveform changes
+        lightPulse.setPeriod((uint32_t)(newPeriod * 1000));
+    }
+    
+    return 0;
+}
+
+// SINE (the default), TRIANGLE or BREATHE
+int SetPulseWaveform(KEYWORD waveform)
+{
+    switch( waveform)
+    {
+        case KW_SINE:       lightPulse.setWaveform(WAVE_SINE);      break;
+        case KW_TRIANGLE:   lightPulse.setWaveform(WAVE_TRIANGLE);  break;
+        case KW_BREATHE:    lightPulse.setWaveform(WAVE_BREATHE);   break;
+        default:            return -1;
     }
     
     return 0;
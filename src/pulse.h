@@ -31,11 +31,45 @@
 #ifndef pulse_h
 #define pulse_h
 
+#include <stdint.h>
+
 #include "Particle.h"
+#include "command.h"
+#include "light.h"
+
+// The pulse is redrawn when its colour next changes: but no more often than PULSE_MIN_TICK_MS,
+// and at least every PULSE_MAX_TICK_MS
+#define PULSE_MIN_TICK_MS       10
+#define PULSE_MAX_TICK_MS       1000
+#define DEFAULT_PULSE_PERIOD_MS 5000
+
+// Waveforms are tables of one period, indexed by the top bits of the phase
+#define WAVEFORM_BITS           8
+#define WAVEFORM_ENTRIES        (1 << WAVEFORM_BITS)
+
+typedef enum
+{
+    WAVE_SINE = 0,
+    WAVE_TRIANGLE,
+    WAVE_BREATHE,
+    NUM_WAVEFORMS
+} WAVEFORM;
+
+// Pulse ticks taken, and how many of them changed the lamp output: exposed to the cloud
+extern int pulseTicks;
+extern int pulseChanges;
 
 int PulseLamp(String command);
-int ChangePulsePeriod(String command);
+int SetPulsePeriod(float seconds);
+int SetPulseWaveform(KEYWORD waveform);
 
+/*
+ * Pulses the lamp colour from full to off and back
+ *
+ * A 32 bit phase accumulator steps through one period of the waveform: the period only changes the step,
+ * not the tick rate. The waveform gives a 16 bit level, so the pulse uses the full PWM resolution.
+ * The timer is set for the next time the output will actually change, rather than ticking at a fixed rate
+ */
 class LightPulser
 {
     public:
@@ -44,16 +78,34 @@ class LightPulser
         void onTimeout();
         void enablePulse(bool enabled);
         
+        void setPeriod(uint32_t periodMs);
+        void setWaveform(WAVEFORM waveform);
+        uint32_t getPeriod(void);
+        WAVEFORM getWaveform(void);
+        
+        // Pulsing, and the colour it pulses from (what the lamp goes back to when it stops)
+        bool   isPulsing(void);
+        COLOUR getPeakColour(void);
+        
     private:
-        int currentLevel;
-        int pulseDirection;
+        uint16_t waveLevel(uint32_t phase);
+        COLOUR   pulseColour(uint32_t phase);
+        uint32_t phaseAfter(uint32_t ms);
+        uint32_t msToNextChange(void);
+        void     retick(void);
+        
+        uint32_t phase;             // One period is 2^32
+        uint32_t phasePerMs;
+        uint32_t periodMs;
+        uint32_t lastTick;          // millis() at the last tick
+        uint32_t tickMs;            // Time to the next tick
+        WAVEFORM waveform;
         bool pulseEnabled;
         
-        int maxRedLevel;
-        int maxGreenLevel;
-        int maxBlueLevel;
+        uint32_t maxRedLevel;
+        uint32_t maxGreenLevel;
+        uint32_t maxBlueLevel;
         
 };
 
 #endif
-
@@ -0,0 +1,232 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "sequence.h"
+#include "admin.h"
+#include "fade.h"
+#include "profile.h"
+#include "trace.h"
+
+#define SEQUENCE_MASK   (SEQUENCE_CAPACITY - 1)
+
+static_assert((SEQUENCE_CAPACITY & SEQUENCE_MASK) == 0, "SEQUENCE_CAPACITY must be a power of 2");
+
+int sequenceLength;
+
+SequencePlayer::SequencePlayer(void) : head(0), count(0), position(0), playing(false), looping(false), stepStart(0)
+{
+    startColour.r = startColour.g = startColour.b = 0;
+}
+
+// Returns the number of keyframes now queued, or -1 if the queue is full
+// Called from the app thread, while the timer may be taking finished keyframes off the head: the queue is only
+// changed with interrupts off
+int SequencePlayer::add(uint16_t r, uint16_t g, uint16_t b, uint32_t transitionMs, uint32_t holdMs)
+{
+    int queued = -1;
+    
+    ATOMIC_BLOCK()
+    {
+        if( count < SEQUENCE_CAPACITY)
+        {
+            KEYFRAME &k = keyframes[(head + count) & SEQUENCE_MASK];
+            
+            k.r = r;
+            k.g = g;
+            k.b = b;
+            k.transitionMs = transitionMs;
+            k.holdMs = holdMs;
+            
+            queued = sequenceLength = ++count;
+        }
+    }
+    
+    return queued;
+}
+
+void SequencePlayer::clear(void)
+{
+    stop();
+    
+    ATOMIC_BLOCK()
+    {
+        head = 0;
+        count = 0;
+        position = 0;
+        sequenceLength = 0;
+    }
+}
+
+// The number of keyframes that can still be added
+int SequencePlayer::space(void)
+{
+    return SEQUENCE_CAPACITY - count;
+}
+
+int SequencePlayer::play(bool loop)
+{
+    if( count == 0)
+    {
+        return -1;
+    }
+    
+    // A fade and a sequence would fight over the lamp
+    colourFade.stop();
+    
+    looping = loop;
+    position = 0;
+    
+    startColour = lamp.getColour();
+    stepStart = millis();
+    playing = true;
+    
+    sequenceTimer.start();
+    PROFILE_RESTART(PROFILE_SEQUENCE_JITTER);
+    
+    return count;
+}
+
+// The lamp stays at whatever colour it had got to
+void SequencePlayer::stop(void)
+{
+    if( playing)
+    {
+        playing = false;
+        sequenceTimer.stop();
+        
+        lamp.setRestoreColour();
+    }
+}
+
+bool SequencePlayer::isPlaying(void)
+{
+    return playing;
+}
+
+KEYFRAME &SequencePlayer::currentKeyframe(void)
+{
+    return keyframes[(head + position) & SEQUENCE_MASK];
+}
+
+void SequencePlayer::nextKeyframe(void)
+{
+    if( looping)
+    {
+        position = (position + 1) % count;
+    }
+    else
+    {
+        ATOMIC_BLOCK()
+        {
+            head = (head + 1) & SEQUENCE_MASK;
+            sequenceLength = --count;
+        }
+    }
+}
+
+void SequencePlayer::onTick(void)
+{
+    if( !playing) return;
+    
+    PROFILE_SCOPE(PROFILE_SEQUENCE_TICK);
+    PROFILE_INTERVAL(PROFILE_SEQUENCE_JITTER, SEQUENCE_TICK_MS * 1000);
+    
+    uint32_t now = millis();
+    
+    // Catch up on any keyframes which have finished since the last tick: at most one pass through the queue,
+    // so a loop of zero length keyframes can't hold us here
+    for( int steps = 0; steps <= SEQUENCE_CAPACITY; steps++)
+    {
+        KEYFRAME &k = currentKeyframe();
+        uint32_t elapsed = now - stepStart;
+        
+        if( elapsed < k.transitionMs)
+        {
+            // Part way through the transition: interpolate in 16 bit fixed point
+            uint32_t t = ((uint64_t)elapsed << 16) / k.transitionMs;
+            
+            lamp.setColour(interpolate16(startColour.r, k.r, t), interpolate16(startColour.g, k.g, t), interpolate16(startColour.b, k.b, t));
+            return;
+        }
+        
+        lamp.setColour(k.r, k.g, k.b);
+        
+        if( elapsed < k.transitionMs + k.holdMs)
+        {
+            return;
+        }
+        
+        // This keyframe is done: the next one starts where it ended, in time and in colour
+        stepStart += k.transitionMs + k.holdMs;
+        startColour = lamp.getColour();
+        
+        nextKeyframe();
+        
+        trace(TRACE_SEQUENCE_STEP, count);
+        
+        if( count == 0)
+        {
+            stop();
+            return;
+        }
+    }
+    
+    stepStart = now;
+}
+
+/*
+ * SEQUENCE ADD r g b fadeMs holdMs     queue a keyframe: returns the number queued, or -1 if full
+ * SEQUENCE PLAY [ONCE|LOOP]            play the queue from the start
+ * SEQUENCE STOP                        stop, leaving the lamp at its current colour
+ * SEQUENCE CLEAR                       stop and empty the queue
+ */
+int SetLampSequence(const CommandLine &command)
+{
+    switch( command.keyword(1))
+    {
+        case KW_ADD:
+            if( command.count() < 7 || command.toInt(5) < 0 || command.toInt(6) < 0) return -1;
+            return sequencer.add(command.toInt(2), command.toInt(3), command.toInt(4), command.toInt(5), command.toInt(6));
+            
+        case KW_PLAY:
+            return sequencer.play(command.keyword(2) == KW_LOOP);
+            
+        case KW_STOP:
+            sequencer.stop();
+            return 0;
+            
+        case KW_CLEAR:
+            sequencer.clear();
+            return 0;
+            
+        default:
+            return -1;
+    }
+}
@@ -0,0 +1,97 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef sequence_h
+#define sequence_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "light.h"
+#include "command.h"
+
+// Keyframes are queued in a fixed ring buffer: the capacity must be a power of 2
+#define SEQUENCE_CAPACITY   32
+#define SEQUENCE_TICK_MS    20      // 50 updates a second during transitions
+
+// The number of keyframes queued, exposed to the cloud
+extern int sequenceLength;
+
+int SetLampSequence(const CommandLine &command);
+
+// Fade to a colour over transitionMs, then hold it for holdMs
+typedef struct
+{
+    uint16_t r;
+    uint16_t g;
+    uint16_t b;
+    uint32_t transitionMs;
+    uint32_t holdMs;
+} KEYFRAME;
+
+/*
+ * Plays a queue of keyframes from a timer, so a whole show can be uploaded in a few calls and runs
+ * with exact timing. Step times are measured from when the sequence started, not from each tick, so they don't drift
+ *
+ * Played ONCE, each keyframe is removed when it finishes (so more can be added while it plays) and the lamp is left
+ * at the last colour. Played in a LOOP, the keyframes are kept and repeated until stopped
+ */
+class SequencePlayer
+{
+    public:
+        SequencePlayer(void);
+        
+        int  add(uint16_t r, uint16_t g, uint16_t b, uint32_t transitionMs, uint32_t holdMs);
+        void clear(void);
+        int  space(void);
+        
+        int  play(bool loop);
+        void stop(void);
+        bool isPlaying(void);
+        
+        void onTick(void);
+        
+    private:
+        KEYFRAME &currentKeyframe(void);
+        void      nextKeyframe(void);
+        
+        KEYFRAME keyframes[SEQUENCE_CAPACITY];
+        uint8_t  head;          // Oldest keyframe
+        uint8_t  count;         // Keyframes queued
+        uint8_t  position;      // Keyframe playing, counted from the head
+        
+        bool     playing;
+        bool     looping;
+        
+        COLOUR   startColour;   // Where the current transition starts from
+        uint32_t stepStart;     // millis() when the current keyframe started
+};
+
+#endif
@@ -0,0 +1,95 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "state.h"
+#include "admin.h"
+#include "stream.h"
+#include "wifi-setup.h"
+
+#include <stdio.h>
+#include <string.h>
+
+char stateReport[STATE_REPORT_LENGTH];
+
+static LAMP_STATE reported;
+static uint32_t changes;
+
+void readLampState(LAMP_STATE *state)
+{
+    bool pulsing = lightPulse.isPulsing();
+    COLOUR c = pulsing ? lightPulse.getPeakColour() : lamp.getColour();
+    
+    state->r = c.r;
+    state->g = c.g;
+    state->b = c.b;
+    state->level = lamp.getBrightnessLevel();
+    state->bits = lamp.getColourResolution();
+    state->pulse = pulsing;
+    state->fade = colourFade.isFading();
+    state->sequence = sequencer.isPlaying();
+    state->stream = colourStream.isActive();
+    state->cloud = conn.getCloudRecoveryState();
+}
+
+bool sameLampState(const LAMP_STATE &a, const LAMP_STATE &b)
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.level == b.level && a.bits == b.bits && a.pulse == b.pulse &&
+           a.fade == b.fade && a.sequence == b.sequence && a.stream == b.stream && a.cloud == b.cloud;
+}
+
+void stateUpdateReport(void)
+{
+    LAMP_STATE current;
+    
+    readLampState(&current);
+    
+    if( stateReport[0] && sameLampState(current, reported)) return;
+    
+    reported = current;
+    changes++;
+    
+    char report[STATE_REPORT_LENGTH];
+    
+    snprintf(report, sizeof(report),
+             "{\"v\":%d,\"n\":%lu,\"r\":%lu,\"g\":%lu,\"b\":%lu,\"level\":%d,\"bits\":%d,\"pulse\":%d,\"fade\":%d,\"sequence\":%d,\"stream\":%d,\"cloud\":%d}",
+             STATE_REPORT_VERSION, (unsigned long)changes, (unsigned long)current.r, (unsigned long)current.g, (unsigned long)current.b,
+             current.level, current.bits, current.pulse, current.fade, current.sequence, current.stream, current.cloud);
+    
+    // The system thread reads the variable whenever the cloud asks: don't let it see a half written one
+    ATOMIC_BLOCK()
+    {
+        memcpy(stateReport, report, sizeof(stateReport));
+    }
+}
+
+uint32_t stateChanges(void)
+{
+    return changes;
+}
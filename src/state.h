@@ -0,0 +1,78 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef state_h
+#define state_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+
+/*
+ * The lamp's state in one place: read by the state publisher, and kept as text in the "state" variable so an
+ * integration gets all of it, consistently, in one request rather than one per variable
+ *
+ * The variable is only rebuilt when something in it changes, and swapped in whole, so a read never sees half
+ * of an update. It is compact JSON:
+ *
+ *   {"v":1,"n":N,"r":R,"g":G,"b":B,"level":L,"bits":B,"pulse":0|1,"fade":0|1,"sequence":0|1,"stream":0|1,"cloud":C}
+ *
+ * v is STATE_REPORT_VERSION, bumped if fields change meaning or go; n counts the changes since boot.
+ * While pulsing, r, g and b are the colour being pulsed. cloud is 0 connected, 1 connecting, 2 listening
+ */
+#define STATE_REPORT_VERSION    1
+#define STATE_REPORT_LENGTH     160
+
+typedef struct
+{
+    uint32_t r;
+    uint32_t g;
+    uint32_t b;
+    uint8_t  level;
+    uint8_t  bits;
+    bool     pulse;
+    bool     fade;
+    bool     sequence;
+    bool     stream;
+    uint8_t  cloud;             // CONNECTED, CONNECTING or LISTENING
+} LAMP_STATE;
+
+extern char stateReport[STATE_REPORT_LENGTH];
+
+void readLampState(LAMP_STATE *state);
+bool sameLampState(const LAMP_STATE &a, const LAMP_STATE &b);
+
+// Call from loop(): rebuilds stateReport if the state has changed since last time
+void stateUpdateReport(void);
+
+// Changes seen (n in the report), and how many times the report has been rebuilt
+uint32_t stateChanges(void);
+
+#endif
@@ -0,0 +1,242 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "stream.h"
+#include "frame.h"
+#include "light.h"
+#include "admin.h"
+#include "trace.h"
+
+#include <stdio.h>
+
+char streamReport[STREAM_REPORT_LENGTH];
+
+static uint16_t streamUint16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t streamUint32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+ColourStream::ColourStream(void)
+{
+    enabled = false;
+    listening = false;
+    active = false;
+    lastSequence = 0;
+    lastFrameAt = 0;
+    minTransit = 0;
+    lastRelaxed = 0;
+    resumePulse = false;
+    
+    received = 0;
+    applied = 0;
+    dropped = 0;
+    late = 0;
+    invalid = 0;
+    timeouts = 0;
+}
+
+void ColourStream::poll(void)
+{
+    bool wanted = enabled && WiFi.ready();
+    
+    if( wanted && !listening)
+    {
+        listening = udp.begin(STREAM_PORT);
+    }
+    else if( !wanted && listening)
+    {
+        udp.stop();
+        listening = false;
+        if( active) timeOut();
+    }
+    
+    if( !listening) return;
+    
+    // A fixed buffer, read straight into: one byte more than a frame, so a longer datagram shows up as the wrong size
+    uint8_t frame[STREAM_FRAME_BYTES + 1];
+    
+    for( int i = 0; i < STREAM_FRAMES_PER_POLL; i++)
+    {
+        int length = udp.receivePacket(frame, sizeof(frame));
+        if( length <= 0) break;
+        
+        handleFrame(frame, length, millis());
+    }
+    
+    if( !active) return;
+    
+    uint32_t now = millis();
+    
+    if( now - lastFrameAt > STREAM_TIMEOUT_MS)
+    {
+        timeOut();
+    }
+    else if( now - lastRelaxed >= 1000)
+    {
+        // Let the quickest transit creep up, so a sender whose clock runs slower than ours isn't slowly all late
+        minTransit++;
+        lastRelaxed = now;
+    }
+}
+
+void ColourStream::handleFrame(const uint8_t *frame, int length, uint32_t now)
+{
+    received++;
+    
+    if( length != STREAM_FRAME_BYTES || (frame[0] >> 4) != STREAM_VERSION || frameCrc8(frame, STREAM_FRAME_BYTES - 1) != frame[STREAM_FRAME_BYTES - 1])
+    {
+        invalid++;
+        return;
+    }
+    
+    uint32_t sequence = streamUint32(frame + 1);
+    int32_t  transit = (int32_t)(now - streamUint32(frame + 5));
+    
+    if( active && (int32_t)(sequence - lastSequence) <= 0)
+    {
+        dropped++;
+        return;
+    }
+    
+    lastSequence = sequence;
+    
+    if( !active || transit < minTransit)
+    {
+        minTransit = transit;
+    }
+    else if( transit - minTransit > STREAM_LATE_MS)
+    {
+        late++;
+        return;
+    }
+    
+    if( !active)
+    {
+        // Streaming takes over the lamp
+        greeting.cancel();
+        resumePulse = lightPulse.isPulsing();
+        lightPulse.enablePulse(false);
+        colourFade.stop();
+        sequencer.stop();
+        
+        active = true;
+        lastRelaxed = now;
+        trace(TRACE_STREAM_START, sequence);
+    }
+    
+    lastFrameAt = now;
+    
+    lamp.setColour(streamUint16(frame + 9), streamUint16(frame + 11), streamUint16(frame + 13));
+    applied++;
+}
+
+// The stream has stopped: back to the colour the cloud last set, and the pulse if there was one
+void ColourStream::timeOut(void)
+{
+    active = false;
+    timeouts++;
+    
+    trace(TRACE_STREAM_TIMEOUT, lastSequence, applied);
+    
+    lamp.restoreColour();
+    
+    if( resumePulse && !lightPulse.isPulsing()) lightPulse.enablePulse(true);
+    resumePulse = false;
+}
+
+void ColourStream::enable(bool on)
+{
+    enabled = on;
+}
+
+bool ColourStream::isListening(void)
+{
+    return listening;
+}
+
+bool ColourStream::isActive(void)
+{
+    return active;
+}
+
+uint32_t ColourStream::getReceived(void)
+{
+    return received;
+}
+
+uint32_t ColourStream::getApplied(void)
+{
+    return applied;
+}
+
+uint32_t ColourStream::getDropped(void)
+{
+    return dropped;
+}
+
+uint32_t ColourStream::getLate(void)
+{
+    return late;
+}
+
+uint32_t ColourStream::getInvalid(void)
+{
+    return invalid;
+}
+
+void ColourStream::updateReport(void)
+{
+    snprintf(streamReport, sizeof(streamReport), "%s received=%lu applied=%lu dropped=%lu late=%lu invalid=%lu timeouts=%lu",
+             active ? "active" : listening ? "on" : "off", (unsigned long)received, (unsigned long)applied, (unsigned long)dropped,
+             (unsigned long)late, (unsigned long)invalid, (unsigned long)timeouts);
+}
+
+// STREAM ON|OFF
+int StreamCommand(const CommandLine &command)
+{
+    switch( command.keyword(1))
+    {
+        case KW_ON:
+            colourStream.enable(true);
+            return 0;
+            
+        case KW_OFF:
+            colourStream.enable(false);
+            return 0;
+            
+        default:
+            return -1;
+    }
+}
@@ -0,0 +1,115 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef stream_h
+#define stream_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+#include "command.h"
+
+/*
+ * Real time colour over UDP: for lighting kept in time with music or video, at rates the cloud can't carry
+ *
+ * Each datagram is one frame of STREAM_FRAME_BYTES, little endian like the command frames (frame.h):
+ *
+ *   byte 0         STREAM_VERSION in the top 4 bits (the bottom 4 are flags, none yet)
+ *   bytes 1..4     sequence number: uint32, one more for each frame sent
+ *   bytes 5..8     timestamp: uint32, the sender's clock in milliseconds
+ *   bytes 9..14    r, g, b: uint16 each, at the lamp's colour resolution (see bits)
+ *   byte 15        CRC-8 (as frameCrc8()) of bytes 0..14
+ *
+ * A frame older than the last one applied (by sequence number) is dropped, and so is one which took more
+ * than STREAM_LATE_MS longer to arrive than the quickest so far (measured against its timestamp, so the two
+ * clocks don't need to agree). The rest go straight to Light::setColour. The first frame stops any pulse,
+ * fade or sequence; STREAM_TIMEOUT_MS after the last one, the lamp goes back to the last colour it was sent
+ * through the cloud, and pulses again if it was pulsing. A frame after a timeout starts a new stream, whatever
+ * its sequence number. Nothing a stream changes is saved (persist.h)
+ */
+#define STREAM_PORT             4210
+#define STREAM_VERSION          1
+#define STREAM_FRAME_BYTES      16
+#define STREAM_FRAMES_PER_POLL  16
+#define STREAM_LATE_MS          50
+#define STREAM_TIMEOUT_MS       2000
+#define STREAM_REPORT_LENGTH    128
+
+class ColourStream
+{
+    public:
+        ColourStream(void);
+        
+        // Call from loop(): listens while enabled and the WiFi is up, and applies whatever has arrived
+        void poll(void);
+        
+        // Apply (or drop) one frame, as received at now (millis())
+        void handleFrame(const uint8_t *frame, int length, uint32_t now);
+        
+        void enable(bool on);
+        bool isListening(void);
+        bool isActive(void);
+        
+        uint32_t getReceived(void);
+        uint32_t getApplied(void);
+        uint32_t getDropped(void);
+        uint32_t getLate(void);
+        uint32_t getInvalid(void);
+        void updateReport(void);
+        
+    private:
+        void timeOut(void);
+        
+        UDP      udp;
+        bool     enabled;
+        bool     listening;
+        bool     active;
+        uint32_t lastSequence;
+        uint32_t lastFrameAt;       // millis()
+        int32_t  minTransit;        // Arrival less timestamp, for the quickest frame
+        uint32_t lastRelaxed;
+        bool     resumePulse;       // The lamp was pulsing when the stream took over
+        
+        uint32_t received;
+        uint32_t applied;
+        uint32_t dropped;           // Out of order, or repeated
+        uint32_t late;
+        uint32_t invalid;           // Wrong size, version or CRC
+        uint32_t timeouts;
+};
+
+extern ColourStream colourStream;
+
+// The counters, exposed to the cloud: refreshed by updateReport()
+extern char streamReport[STREAM_REPORT_LENGTH];
+
+int StreamCommand(const CommandLine &command);
+
+#endif
@@ -0,0 +1,144 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "trace.h"
+#include "admin.h"
+
+#define TRACE_MASK  (TRACE_CAPACITY - 1)
+
+static_assert((TRACE_CAPACITY & TRACE_MASK) == 0, "TRACE_CAPACITY must be a power of 2");
+
+#define TRACE_EVENT_FORMAT(id, format)  format,
+
+static const char *traceFormats[NUM_TRACE_EVENTS] = {
+    TRACE_EVENTS(TRACE_EVENT_FORMAT)
+};
+
+static TRACE_RECORD traceRing[TRACE_CAPACITY];
+
+// head is only moved by writers (with interrupts off), tail only by traceDrain()
+static volatile uint32_t traceHead;
+static volatile uint32_t traceTail;
+static volatile uint32_t traceDropped;
+
+void traceRecord(TRACE_EVENT event, int numArgs, int32_t a0, int32_t a1, int32_t a2, int32_t a3)
+{
+    if( !debugEnabled)
+    {
+        return;
+    }
+    
+    uint32_t now = micros();
+    
+    ATOMIC_BLOCK()
+    {
+        if( traceHead - traceTail >= TRACE_CAPACITY)
+        {
+            traceDropped++;
+        }
+        else
+        {
+            TRACE_RECORD &r = traceRing[traceHead & TRACE_MASK];
+            
+            r.micros = now;
+            r.event = event;
+            r.numArgs = numArgs;
+            r.args[0] = a0;
+            r.args[1] = a1;
+            r.args[2] = a2;
+            r.args[3] = a3;
+            
+            traceHead++;
+        }
+    }
+}
+
+static uint8_t *putUint32(uint8_t *p, uint32_t value)
+{
+    *p++ = value;
+    *p++ = value >> 8;
+    *p++ = value >> 16;
+    *p++ = value >> 24;
+    
+    return p;
+}
+
+int traceEncode(const TRACE_RECORD &record, uint8_t *out)
+{
+    uint8_t *p = out;
+    
+    *p++ = TRACE_SYNC;
+    *p++ = record.event;
+    *p++ = record.numArgs;
+    p = putUint32(p, record.micros);
+    
+    for( int i = 0; i < record.numArgs && i < TRACE_MAX_ARGS; i++)
+    {
+        p = putUint32(p, record.args[i]);
+    }
+    
+    uint8_t sum = 0;
+    for( uint8_t *q = out + 1; q < p; q++) sum += *q;
+    *p++ = sum;
+    
+    return p - out;
+}
+
+void traceDrain(void)
+{
+    uint8_t bytes[TRACE_MAX_BYTES];
+    
+    // Own up to dropped records first, once there's room to
+    if( traceDropped && traceHead - traceTail < TRACE_CAPACITY)
+    {
+        uint32_t dropped;
+        
+        ATOMIC_BLOCK()
+        {
+            dropped = traceDropped;
+            traceDropped = 0;
+        }
+        
+        trace(TRACE_DROPPED, dropped);
+    }
+    
+    while( traceTail != traceHead && Serial.availableForWrite() >= TRACE_MAX_BYTES)
+    {
+        int length = traceEncode(traceRing[traceTail & TRACE_MASK], bytes);
+        
+        Serial.write(bytes, length);
+        traceTail++;
+    }
+}
+
+const char *traceFormat(uint8_t event)
+{
+    return event < NUM_TRACE_EVENTS ? traceFormats[event] : nullptr;
+}
@@ -0,0 +1,105 @@
+
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef trace_h
+#define trace_h
+
+#include <stdint.h>
+
+#include "Particle.h"
+
+/*
+ * Debug tracing: compact binary records in a fixed ring, written from any context (commands or timer callbacks)
+ * and sent to the USB serial port from loop() as it has room. host/trace decodes them back into text.
+ *
+ * Records are only written with DEBUG ON. Writing one is a timestamp and a few stores, with interrupts
+ * held off briefly so timer callbacks can't interleave: no formatting, no waiting for the serial port.
+ * If the ring fills, new records are dropped and counted.
+ *
+ * On the serial port each record is
+ *   TRACE_SYNC, event, number of args, micros (uint32), args (int32 each), checksum (sum of the bytes after TRACE_SYNC)
+ * all little endian. TRACE_SYNC is not ASCII, so records can be told apart from ordinary text output
+ */
+
+#define TRACE_CAPACITY      64      // Records: a power of 2
+#define TRACE_MAX_ARGS      4
+#define TRACE_SYNC          0xA5
+#define TRACE_MAX_BYTES     (1 + 2 + 4 + 4 * TRACE_MAX_ARGS + 1)
+
+// Every event, with how the decoder shows it: %d is an argument, %k an argument which is a KEYWORD
+#define TRACE_EVENTS(X) \
+    X(TRACE_COLOUR_COMMAND,     "colour command %k %d %d %d") \
+    X(TRACE_PULSE_COMMAND,      "pulse command %k %k %d") \
+    X(TRACE_ADMIN_COMMAND,      "admin command %k %k") \
+    X(TRACE_INVALID_COMMAND,    "not a valid command: %k") \
+    X(TRACE_GRADIENT_INPUT,     "computing colour - %k value %d range %d to %d") \
+    X(TRACE_GRADIENT_COLOUR,    "colour %d %d %d") \
+    X(TRACE_FRAME,              "frame: %d of %d operations applied") \
+    X(TRACE_PULSE_TICK,         "pulse tick: red %d green %d blue %d, next in %d ms") \
+    X(TRACE_FADE_DONE,          "fade done: %d %d %d") \
+    X(TRACE_SEQUENCE_STEP,      "sequence keyframe done: %d queued") \
+    X(TRACE_STREAM_START,       "stream started at frame %d") \
+    X(TRACE_STREAM_TIMEOUT,     "stream timed out after frame %d: %d frames applied") \
+    X(TRACE_DROPPED,            "%d trace records dropped")
+
+#define TRACE_EVENT_ID(id, format)  id,
+
+typedef enum
+{
+    TRACE_EVENTS(TRACE_EVENT_ID)
+    NUM_TRACE_EVENTS
+} TRACE_EVENT;
+
+typedef struct
+{
+    uint32_t micros;
+    uint8_t  event;
+    uint8_t  numArgs;
+    int32_t  args[TRACE_MAX_ARGS];
+} TRACE_RECORD;
+
+void traceRecord(TRACE_EVENT event, int numArgs, int32_t a0, int32_t a1, int32_t a2, int32_t a3);
+
+inline void trace(TRACE_EVENT event)                                             { traceRecord(event, 0, 0, 0, 0, 0); }
+inline void trace(TRACE_EVENT event, int32_t a0)                                 { traceRecord(event, 1, a0, 0, 0, 0); }
+inline void trace(TRACE_EVENT event, int32_t a0, int32_t a1)                     { traceRecord(event, 2, a0, a1, 0, 0); }
+inline void trace(TRACE_EVENT event, int32_t a0, int32_t a1, int32_t a2)         { traceRecord(event, 3, a0, a1, a2, 0); }
+inline void trace(TRACE_EVENT event, int32_t a0, int32_t a1, int32_t a2, int32_t a3) { traceRecord(event, 4, a0, a1, a2, a3); }
+
+// Send what is waiting to the serial port, as far as it has room without blocking. Call from loop()
+void traceDrain(void);
+
+// Encode a record for the serial port: returns the number of bytes (at most TRACE_MAX_BYTES)
+int  traceEncode(const TRACE_RECORD &record, uint8_t *out);
+
+// The decoder's format for an event, or nullptr
+const char *traceFormat(uint8_t event);
+
+#endif
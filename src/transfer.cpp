@@ -0,0 +1,156 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "transfer.h"
+#include "math.h"
+
+// Nothing is allocated until setResolution(): we're constructed before setup() runs
+OutputTransfer::OutputTransfer(void) : tables(nullptr), bits(8), tableBits(0), shift(0), brightnessLevel(100), gamma(1.0f)
+{
+    whiteBalance[TRANSFER_RED] = whiteBalance[TRANSFER_GREEN] = whiteBalance[TRANSFER_BLUE] = 100;
+}
+
+void OutputTransfer::setResolution(int newBits)
+{
+    int newTableBits = newBits > TRANSFER_TABLE_BITS ? TRANSFER_TABLE_BITS : newBits;
+    
+    // Only a different table size needs a new buffer
+    if( !tables || newTableBits != tableBits)
+    {
+        delete[] tables;
+        tables = new uint16_t[3 << newTableBits];
+    }
+    
+    bits = newBits;
+    tableBits = newTableBits;
+    shift = bits - tableBits;
+    
+    rebuild();
+}
+
+// Level is a percentage: 1-100
+void OutputTransfer::setBrightnessLevel(int level)
+{
+    if( level != brightnessLevel)
+    {
+        brightnessLevel = level;
+        rebuild();
+    }
+}
+
+// Allowed range: 0.2 - 5.0
+void OutputTransfer::setGamma(float newGamma)
+{
+    if( newGamma < 0.2f) newGamma = 0.2f;
+    if( newGamma > 5.0f) newGamma = 5.0f;
+    
+    if( newGamma != gamma)
+    {
+        gamma = newGamma;
+        rebuild();
+    }
+}
+
+float OutputTransfer::getGamma(void)
+{
+    return gamma;
+}
+
+// Trims are the percentage of full output each channel gives at full colour: 0-100
+void OutputTransfer::setWhiteBalance(int red, int green, int blue)
+{
+    int trims[3] = { red, green, blue };
+    bool changed = false;
+    
+    for( int c = 0; c < 3; c++)
+    {
+        if( trims[c] < 0) trims[c] = 0;
+        if( trims[c] > 100) trims[c] = 100;
+        
+        if( trims[c] != whiteBalance[c])
+        {
+            whiteBalance[c] = trims[c];
+            changed = true;
+        }
+    }
+    
+    if( changed) rebuild();
+}
+
+int OutputTransfer::getWhiteBalance(int channel)
+{
+    return whiteBalance[channel];
+}
+
+void OutputTransfer::rebuild(void)
+{
+    // Settings changed before setup() are picked up by setResolution()
+    if( !tables) return;
+    
+    uint32_t entries    = 1UL << tableBits;
+    uint32_t maxOutput  = (1UL << bits) - 1;
+    
+    // CIE 1931: relative luminance for a perceived lightness L* of brightnessLevel
+    float lightness = brightnessLevel;
+    float luminance = lightness > 8 ? powf((lightness + 16) / 116, 3) : lightness / 903.3f;
+    
+    // The trims are applied in 16.16 fixed point, so there is only one float calculation per entry
+    uint32_t trims[3];
+    
+    for( int c = 0; c < 3; c++)
+    {
+        trims[c] = (whiteBalance[c] << 16) / 100;
+    }
+    
+    uint16_t *red   = tables;
+    uint16_t *green = tables + entries;
+    uint16_t *blue  = tables + 2 * entries;
+    
+    // Linear (the default): the output is a straight line, so step along it in 16.16 fixed point with no float at all
+    float    fullScale = luminance * maxOutput;
+    uint32_t step      = (uint32_t)(fullScale * 65536 / (entries - 1) + 0.5f);
+    
+    for( uint32_t v = 0; v < entries; v++)
+    {
+        uint32_t output;
+        
+        if( gamma == 1.0f)
+        {
+            output = (v * (uint64_t)step + 0x8000) >> 16;
+        }
+        else
+        {
+            output = (uint32_t)(powf((float)v / (entries - 1), gamma) * fullScale + 0.5f);
+        }
+        
+        red[v]   = (output * (uint64_t)trims[TRANSFER_RED] + 0x8000) >> 16;
+        green[v] = (output * (uint64_t)trims[TRANSFER_GREEN] + 0x8000) >> 16;
+        blue[v]  = (output * (uint64_t)trims[TRANSFER_BLUE] + 0x8000) >> 16;
+    }
+}
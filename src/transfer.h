@@ -0,0 +1,86 @@
+/*
+ * This app controls the "ambient orb" RGB light clone and exposes a few simple control points to the particle cloud
+ *
+ * Liam Friel
+ *
+ * Copyright (c) 2016/2017 Liam Friel
+ *
+ * Permission is hereby granted, free of charge, 
+ * to any person obtaining a copy of this software and 
+ * associated documentation files (the "Software"), to 
+ * deal in the Software without restriction, including 
+ * without limitation the rights to use, copy, modify, 
+ * merge, publish, distribute, sublicense, and/or sell 
+ * copies of the Software, and to permit persons to whom 
+ * the Software is furnished to do so, 
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice 
+ * shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, 
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES 
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. 
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR 
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, 
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE 
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef transfer_h
+#define transfer_h
+
+#include <stdint.h>
+
+// The transfer tables cover colour values up to this resolution one entry per value.
+// Above it, colour values are looked up at this resolution (the output keeps the full PWM resolution).
+// The tables are sized to the resolution in use: 1.5KB at 8 bits, 24KB at this one
+#define TRANSFER_TABLE_BITS     12
+
+#define TRANSFER_RED    0
+#define TRANSFER_GREEN  1
+#define TRANSFER_BLUE   2
+
+/*
+ * The output stage: maps a colour value to the PWM duty cycle for its channel
+ *
+ * Composes the colour gamma, the brightness level and the per channel white balance trims into one
+ * table per channel, so that writing a colour is just a table lookup. The tables are rebuilt straight
+ * away when something changes, on the command path, so a write from a timer never has to.
+ *
+ * The three tables share one buffer, allocated by setResolution(): call it (through
+ * Light::setColourResolution()) before the first write.
+ *
+ * The brightness level (1-100) is treated as perceived lightness (CIE L*), so each LEVEL/DIM step
+ * looks the same size. Gamma defaults to 1.0: colour values map linearly onto the PWM range.
+ */
+class OutputTransfer
+{
+    public:
+        OutputTransfer(void);
+        
+        void  setResolution(int bits);
+        void  setBrightnessLevel(int level);
+        void  setGamma(float gamma);
+        float getGamma(void);
+        void  setWhiteBalance(int red, int green, int blue);
+        int   getWhiteBalance(int channel);
+        
+        // The table for a channel, and the shift to apply to colour values to index it
+        const uint16_t *table(int channel)  { return tables + (channel << tableBits); }
+        int             indexShift(void)    { return shift; }
+        
+    private:
+        void rebuild(void);
+        
+        uint16_t *tables;       // Red, green then blue: 1 << tableBits entries each
+        
+        int      bits;
+        int      tableBits;
+        int      shift;
+        int      brightnessLevel;
+        float    gamma;
+        int      whiteBalance[3];
+};
+
+#endif
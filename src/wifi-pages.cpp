@@ -0,0 +1,463 @@
+// Generated by python/softapPages.py from softap/: do not edit
+
+#include "wifi-pages.h"
+
+// /index.html, from index.html: 2676 bytes, 1040 gzipped
+const uint8_t index_html_gz[1040] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0xdb, 0x6e, 0xe3, 0x36,
+    0x10, 0xfd, 0x15, 0x16, 0x41, 0xc0, 0x87, 0x46, 0xb6, 0x6c, 0xaf, 0x37, 0xa9, 0x2c, 0x7b, 0x1f,
+    0x36, 0x6d, 0x51, 0xa0, 0x45, 0x0b, 0xa4, 0x45, 0x51, 0x14, 0xfb, 0x40, 0x89, 0xe3, 0x98, 0x0d,
+    0x45, 0x0a, 0x14, 0x7d, 0xab, 0xe1, 0x7f, 0xef, 0xf0, 0x22, 0x5b, 0xb2, 0xd3, 0xbd, 0x21, 0x80,
+    0xc3, 0x19, 0x92, 0x73, 0x39, 0x67, 0x66, 0xa8, 0xfc, 0x9b, 0xc7, 0x5f, 0xdf, 0xff, 0xfe, 0xd7,
+    0x6f, 0xdf, 0x93, 0x95, 0xad, 0xe4, 0x22, 0x8f, 0xbf, 0xc0, 0xf8, 0x22, 0xaf, 0xc0, 0x32, 0xa2,
+    0x58, 0x05, 0x73, 0xba, 0x11, 0xb0, 0xad, 0xb5, 0xb1, 0x94, 0x94, 0x5a, 0x59, 0x50, 0x76, 0x4e,
+    0xb7, 0x82, 0xdb, 0xd5, 0x9c, 0xc3, 0x46, 0x94, 0x90, 0x78, 0xe1, 0x8e, 0x08, 0x25, 0xac, 0x60,
+    0x32, 0x69, 0x4a, 0x26, 0x61, 0x3e, 0xa2, 0x8b, 0xdc, 0x0a, 0x2b, 0x61, 0xf1, 0x04, 0x76, 0x5d,
+    0x93, 0xbd, 0x5e, 0x1b, 0x12, 0x2e, 0xe4, 0xc3, 0xb0, 0x91, 0x37, 0x76, 0x8f, 0xff, 0x9c, 0xd7,
+    0xc3, 0x0a, 0xc4, 0xf3, 0xca, 0x66, 0xa3, 0x34, 0xbd, 0x9d, 0x55, 0xcc, 0x3c, 0x0b, 0x95, 0xb1,
+    0xb5, 0xd5, 0xb3, 0x82, 0x95, 0x2f, 0xcf, 0x46, 0xaf, 0x15, 0x4f, 0x4a, 0x2d, 0xb5, 0xc9, 0xb6,
+    0x2b, 0x61, 0xe1, 0x58, 0x68, 0xbe, 0x3f, 0x14, 0x7a, 0x97, 0x34, 0xe2, 0x5f, 0xa1, 0x9e, 0xb3,
+    0x42, 0x1b, 0x0e, 0x26, 0x41, 0xcd, 0xac, 0x12, 0x2a, 0xe9, 0x5a, 0xab, 0x19, 0xe7, 0xee, 0xc8,
+    0x38, 0xad, 0x77, 0xd7, 0xe6, 0x6e, 0x46, 0x8c, 0x15, 0x90, 0xce, 0x96, 0x98, 0x59, 0xb2, 0x64,
+    0x95, 0x90, 0xfb, 0x8c, 0xfe, 0xbc, 0x2e, 0x05, 0x67, 0xe4, 0x89, 0xa9, 0x86, 0xfc, 0xa1, 0x44,
+    0xa9, 0x39, 0xd0, 0xbb, 0x56, 0xfb, 0xa3, 0x61, 0xca, 0xc9, 0x0d, 0xee, 0x26, 0x0d, 0x18, 0xb1,
+    0x0c, 0x97, 0xb7, 0xc1, 0xa7, 0xd2, 0xa6, 0x62, 0x72, 0xd6, 0x09, 0x36, 0xe6, 0x93, 0x58, 0x5d,
+    0x67, 0x69, 0x2b, 0x48, 0x58, 0xda, 0x90, 0x61, 0x54, 0x18, 0x7f, 0xbb, 0xab, 0x29, 0xb4, 0xb5,
+    0xba, 0xf2, 0x57, 0x76, 0x01, 0xe3, 0xec, 0x4d, 0xea, 0x92, 0xb0, 0xb0, 0xb3, 0x09, 0x93, 0xe2,
+    0x59, 0x65, 0x25, 0xb2, 0x01, 0x66, 0x16, 0xd2, 0xcf, 0x46, 0xf5, 0x8e, 0x34, 0x5a, 0x0a, 0x4e,
+    0x6e, 0xde, 0xc2, 0x5b, 0xb8, 0x4f, 0xe3, 0x46, 0x62, 0x18, 0x17, 0xeb, 0x26, 0x7b, 0x53, 0xef,
+    0x8e, 0x5c, 0x6c, 0x0e, 0x9d, 0x80, 0xc6, 0x53, 0x34, 0xd8, 0x77, 0xe8, 0x54, 0xc7, 0xd5, 0xe8,
+    0x73, 0x4e, 0x15, 0x6b, 0x5c, 0xab, 0x43, 0xf4, 0xd2, 0x22, 0x5a, 0xde, 0x4f, 0x0b, 0x78, 0x0d,
+    0xea, 0xb0, 0xd1, 0x85, 0xa6, 0x1f, 0x9f, 0xf3, 0x12, 0xa9, 0x9b, 0xb8, 0x44, 0x3d, 0xae, 0xc8,
+    0x30, 0x64, 0xa3, 0x69, 0x2b, 0x46, 0x98, 0x0b, 0x2d, 0x79, 0x74, 0x3f, 0x10, 0xaa, 0x5e, 0x5b,
+    0xe4, 0x5c, 0xd6, 0x60, 0x0e, 0xd7, 0x6e, 0x0b, 0x70, 0x7f, 0xb3, 0x7e, 0x90, 0x51, 0x19, 0xa5,
+    0x88, 0x56, 0x97, 0x9b, 0xc9, 0x29, 0xbd, 0x8c, 0x8b, 0x86, 0x15, 0x12, 0xf8, 0x57, 0xd9, 0x0e,
+    0xf5, 0xea, 0x43, 0xfc, 0xdb, 0xee, 0x6b, 0x6c, 0x27, 0x47, 0x1f, 0xfd, 0x70, 0xd7, 0x55, 0xd5,
+    0xac, 0x69, 0xb6, 0x68, 0x83, 0x7e, 0x38, 0xbc, 0x5e, 0xf0, 0x17, 0x81, 0xf6, 0xfc, 0x7d, 0x02,
+    0x49, 0xcf, 0xdd, 0x75, 0xc9, 0xf4, 0xb1, 0x0d, 0x01, 0x7e, 0x65, 0xa6, 0xbd, 0xec, 0x5c, 0x00,
+    0x1a, 0xf3, 0xa8, 0x75, 0x83, 0xe3, 0x00, 0xd1, 0x33, 0x20, 0x99, 0x15, 0x1b, 0x77, 0xd5, 0x17,
+    0x4e, 0x92, 0x0e, 0x26, 0x13, 0xa8, 0xda, 0x2e, 0x6f, 0x93, 0xc1, 0x45, 0xdb, 0xb5, 0x83, 0x29,
+    0x6e, 0x87, 0x82, 0x1f, 0x4d, 0x6f, 0x8f, 0x12, 0x1b, 0x54, 0x1e, 0x62, 0x1b, 0xfb, 0x72, 0xbc,
+    0xc7, 0x8c, 0x5a, 0x39, 0x5a, 0xed, 0xaa, 0x3c, 0x7f, 0xd3, 0xdb, 0x19, 0x66, 0x53, 0x4b, 0xb6,
+    0xcf, 0x84, 0x92, 0x42, 0x41, 0x52, 0x48, 0x5d, 0xbe, 0x44, 0xbb, 0x0f, 0x38, 0x18, 0x3a, 0x98,
+    0xb8, 0x1b, 0xaf, 0x65, 0x91, 0x95, 0x2b, 0x28, 0x5f, 0x80, 0x7f, 0x1b, 0x62, 0xb8, 0x2c, 0xc0,
+    0x59, 0xaf, 0xb0, 0x8f, 0x03, 0x9c, 0x7c, 0x4a, 0xb9, 0x08, 0xc0, 0x18, 0x6d, 0xae, 0x8f, 0x5f,
+    0xb1, 0x70, 0x1c, 0x78, 0x47, 0x89, 0x6b, 0xca, 0xff, 0x99, 0x66, 0x01, 0xa5, 0xf1, 0xb9, 0xff,
+    0x3e, 0x36, 0x39, 0xbe, 0xa0, 0x78, 0x3e, 0x39, 0x2c, 0xb0, 0x01, 0x5a, 0x12, 0xba, 0x63, 0xd4,
+    0x15, 0xcb, 0x8d, 0x02, 0x8b, 0xe5, 0xfa, 0xd2, 0x24, 0x9d, 0x69, 0xf2, 0xb1, 0xb8, 0x2e, 0xa1,
+    0xbe, 0x89, 0x2f, 0x87, 0xe0, 0x87, 0x6b, 0x4c, 0x6e, 0x1c, 0x8c, 0x49, 0x1c, 0x2d, 0x6e, 0x9a,
+    0x9f, 0xa2, 0x70, 0xae, 0xf1, 0x09, 0x52, 0x50, 0xda, 0x76, 0xbf, 0xe5, 0x38, 0x90, 0x7b, 0x71,
+    0xba, 0x3b, 0x79, 0x47, 0xe9, 0xe7, 0x41, 0x78, 0x31, 0xe5, 0xbc, 0xcf, 0xb6, 0x3d, 0x7b, 0x23,
+    0x31, 0xbd, 0x1a, 0x89, 0xce, 0xc5, 0x31, 0x1f, 0x86, 0x57, 0x2d, 0x1f, 0x86, 0x77, 0xd4, 0xbd,
+    0x54, 0xf8, 0xa6, 0x8e, 0x17, 0xef, 0x43, 0xe0, 0xe1, 0x21, 0x94, 0xac, 0xaa, 0x89, 0xd5, 0x84,
+    0x91, 0x3f, 0xc5, 0x0f, 0x82, 0x44, 0x3c, 0x9d, 0xc6, 0x3d, 0xb1, 0x46, 0x4b, 0x22, 0x2c, 0x5a,
+    0x18, 0xe3, 0xcd, 0xc9, 0xe2, 0xd1, 0x83, 0x45, 0x7e, 0x7a, 0xcc, 0x50, 0x35, 0x59, 0xe4, 0xbe,
+    0x50, 0x89, 0x2f, 0x54, 0x87, 0x1e, 0x11, 0x7c, 0x4e, 0x4f, 0x80, 0x52, 0xe2, 0x9a, 0x7a, 0x4e,
+    0xc7, 0x53, 0x4a, 0x36, 0x4c, 0xae, 0x71, 0x49, 0x49, 0xdb, 0xd7, 0x43, 0x8c, 0xc7, 0xe3, 0x16,
+    0x6e, 0xd3, 0x20, 0xe0, 0xbb, 0x2e, 0x31, 0xc3, 0x39, 0xed, 0x0e, 0x52, 0xea, 0xcd, 0x96, 0xba,
+    0xde, 0x47, 0xa8, 0x29, 0x66, 0x50, 0xef, 0xf3, 0x61, 0x90, 0x16, 0x39, 0x52, 0xef, 0x8f, 0x78,
+    0xb6, 0x50, 0xa0, 0x3e, 0xd6, 0x27, 0x94, 0xc8, 0x52, 0x1b, 0xb2, 0x11, 0x8d, 0x40, 0x97, 0xbd,
+    0xfc, 0x9a, 0x10, 0x7f, 0x0c, 0xe1, 0x74, 0xb9, 0x8d, 0xa2, 0x17, 0x93, 0xb7, 0x74, 0xf6, 0x36,
+    0x44, 0x0f, 0x67, 0x9f, 0xdd, 0xfa, 0xa3, 0x97, 0x9b, 0x6d, 0x85, 0xb8, 0x3d, 0xe2, 0xc9, 0x40,
+    0x78, 0x62, 0x99, 0x10, 0xa5, 0x15, 0xe0, 0x8d, 0x7a, 0xf1, 0x88, 0x3e, 0x2c, 0x69, 0x00, 0x02,
+    0x21, 0xd1, 0xe2, 0x3b, 0xf2, 0x8b, 0xde, 0x00, 0xa9, 0x00, 0x21, 0xd1, 0xf8, 0xb8, 0x3b, 0x46,
+    0xfc, 0x3e, 0x36, 0x15, 0xd6, 0xe6, 0x1d, 0xb1, 0x2b, 0x50, 0xc4, 0x80, 0xfb, 0xc8, 0x51, 0x83,
+    0x7c, 0x58, 0x2f, 0x72, 0x4c, 0xb6, 0xea, 0xf9, 0x75, 0x0a, 0xda, 0x63, 0xe9, 0x3c, 0xdf, 0xfd,
+    0xc1, 0xb3, 0x74, 0xa6, 0x0a, 0xa3, 0x2b, 0x61, 0x85, 0x43, 0x02, 0x4c, 0xe7, 0xc0, 0x17, 0xf3,
+    0xd5, 0xac, 0xf4, 0xf6, 0xc4, 0xd7, 0x13, 0x0a, 0x67, 0x04, 0x7b, 0x86, 0x9a, 0x75, 0x51, 0x09,
+    0x4b, 0x7b, 0x71, 0x9f, 0x69, 0xf6, 0x72, 0x07, 0x7b, 0x97, 0x51, 0x8b, 0x72, 0x53, 0x1a, 0x51,
+    0x23, 0x70, 0xa6, 0x44, 0x2b, 0xee, 0xcb, 0x6e, 0xf0, 0x4f, 0xf3, 0x6e, 0x33, 0x7f, 0x18, 0xf1,
+    0xe5, 0xfd, 0x84, 0x17, 0xe3, 0xe5, 0xf8, 0x21, 0x2d, 0xbe, 0x7b, 0x70, 0xac, 0x84, 0xa3, 0xb8,
+    0x08, 0x3d, 0x30, 0xf4, 0x9f, 0x97, 0xff, 0x01, 0xc4, 0x62, 0x3e, 0x48, 0x74, 0x0a, 0x00, 0x00,
+};
+
+// /setup.js, from rsa-utils/jsbn_1.js rsa-utils/jsbn_2.js rsa-utils/prng4.js rsa-utils/rng.js rsa-utils/rsa.js script.js: 18429 bytes, 6182 gzipped
+const uint8_t setup_js_gz[6182] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3c, 0xdb, 0x76, 0xdb, 0x38,
+    0x92, 0xef, 0xf3, 0x15, 0xcc, 0xc3, 0x48, 0xa4, 0x49, 0x29, 0x92, 0x7c, 0x69, 0x8f, 0x29, 0x28,
+    0x27, 0xb1, 0x93, 0xe9, 0xec, 0xb6, 0x93, 0x1c, 0x3b, 0x9d, 0xd9, 0x5d, 0xb7, 0x27, 0x07, 0x04,
+    0x21, 0x89, 0x36, 0x45, 0x2a, 0x24, 0x65, 0x5b, 0xed, 0xf8, 0xdf, 0xb7, 0x0a, 0x17, 0x12, 0x90,
+    0x29, 0xdb, 0xdb, 0x0f, 0x9b, 0x3e, 0x89, 0x49, 0xa0, 0xaa, 0x50, 0xf7, 0x2a, 0x00, 0x74, 0xdf,
+    0xd0, 0xc2, 0x89, 0xa3, 0xa4, 0x2a, 0xc3, 0x1b, 0x78, 0x62, 0x34, 0xa3, 0xc5, 0x9a, 0x0c, 0xee,
+    0x62, 0x4e, 0xe3, 0x88, 0xf3, 0x29, 0xa3, 0x53, 0x2e, 0x66, 0xae, 0xbe, 0xa7, 0x0b, 0xe2, 0xba,
+    0x12, 0xa0, 0x33, 0xb8, 0x9b, 0x8a, 0x3f, 0x1e, 0x01, 0x58, 0x09, 0xe5, 0x85, 0xd3, 0x55, 0xc6,
+    0xaa, 0x24, 0xcf, 0x9c, 0x77, 0xc9, 0xec, 0x63, 0x56, 0xf1, 0x19, 0x2f, 0x5c, 0x1a, 0x44, 0x01,
+    0xf3, 0xee, 0x93, 0xa9, 0x4b, 0x5f, 0x91, 0x6c, 0x95, 0xa6, 0x1e, 0x3c, 0x76, 0xb3, 0xd5, 0x22,
+    0xe2, 0x45, 0x97, 0x90, 0x6a, 0xbd, 0xe4, 0xf9, 0xd4, 0xa1, 0x5e, 0x35, 0x4f, 0xca, 0xfe, 0xb4,
+    0xc8, 0x17, 0x9f, 0xc4, 0x94, 0xc2, 0x0b, 0x79, 0x5a, 0x72, 0x07, 0x30, 0x22, 0x22, 0x90, 0x3b,
+    0x9d, 0x6e, 0x59, 0x15, 0x49, 0x36, 0xeb, 0xbe, 0x6a, 0x41, 0x3d, 0x17, 0x53, 0x80, 0x3a, 0xda,
+    0x3f, 0x50, 0xa8, 0x8f, 0xe7, 0x22, 0x2f, 0x7c, 0xa8, 0x19, 0xcd, 0xa2, 0xc4, 0xf5, 0xee, 0x0b,
+    0x5e, 0xad, 0x0a, 0x78, 0xe1, 0xb7, 0x26, 0xe7, 0x82, 0x59, 0x03, 0x96, 0x2e, 0x86, 0x92, 0xab,
+    0x20, 0x0e, 0x78, 0x30, 0xf5, 0xee, 0x6f, 0xe7, 0x49, 0xca, 0xdd, 0x5e, 0x6f, 0x3a, 0x21, 0x03,
+    0xef, 0x1e, 0x75, 0x34, 0x23, 0xd1, 0x0e, 0xae, 0x78, 0x41, 0x7d, 0xff, 0xd2, 0x67, 0x17, 0xf1,
+    0xa5, 0xcf, 0x43, 0x4e, 0x4e, 0x69, 0x35, 0xef, 0x4f, 0xd3, 0x3c, 0x2f, 0xdc, 0xd9, 0xeb, 0xc1,
+    0xdd, 0xde, 0x40, 0xfc, 0xf1, 0x42, 0x00, 0x00, 0x38, 0x32, 0x03, 0x6d, 0xee, 0x4a, 0x75, 0x86,
+    0x0f, 0x8a, 0x17, 0x6e, 0x2d, 0x3c, 0xb2, 0x17, 0x56, 0x4b, 0x01, 0xda, 0x2f, 0x80, 0x13, 0xcc,
+    0x49, 0x34, 0x99, 0x0c, 0xf7, 0xc3, 0xc7, 0xfc, 0x24, 0x44, 0x72, 0x73, 0xa9, 0x40, 0xa5, 0x21,
+    0x49, 0xcd, 0xa2, 0x40, 0xc3, 0xb1, 0x6b, 0x32, 0xdf, 0x49, 0xfc, 0xab, 0x9d, 0x59, 0x98, 0x90,
+    0x19, 0x3c, 0xb9, 0xee, 0xb5, 0x42, 0xf1, 0xc6, 0xe3, 0xe1, 0xbe, 0x27, 0x65, 0x71, 0x79, 0xc3,
+    0xe9, 0x14, 0x14, 0x4c, 0xdc, 0x64, 0x32, 0x99, 0xec, 0x0e, 0x3c, 0xdf, 0xbd, 0x9e, 0x20, 0x2d,
+    0xcf, 0x9f, 0xef, 0x5c, 0x01, 0x98, 0x1c, 0xd5, 0xf2, 0x25, 0x06, 0xd6, 0x16, 0x01, 0x77, 0xb7,
+    0x09, 0xb8, 0xdb, 0x08, 0xb8, 0xf7, 0x8c, 0x80, 0xbb, 0xed, 0x02, 0xee, 0x3d, 0x21, 0xe0, 0xae,
+    0x12, 0x70, 0xcf, 0x6b, 0x8c, 0x85, 0x32, 0x8d, 0x0e, 0xa5, 0x48, 0x38, 0x01, 0x12, 0x99, 0x82,
+    0xb4, 0xc8, 0x01, 0xee, 0x89, 0xc1, 0xd1, 0xe9, 0xb8, 0x19, 0xbd, 0x49, 0x66, 0xb4, 0xca, 0x8b,
+    0x3e, 0x5d, 0x2e, 0x3f, 0xd1, 0x05, 0x27, 0xa4, 0x7b, 0x9a, 0xb0, 0x22, 0x2f, 0xf3, 0x69, 0xe5,
+    0xa0, 0x63, 0x15, 0x19, 0xaf, 0x9c, 0xf7, 0x77, 0xcb, 0x34, 0x2f, 0xc0, 0xff, 0x3d, 0xef, 0xbe,
+    0x71, 0xb8, 0xfe, 0xb2, 0xc8, 0xab, 0x1c, 0xbd, 0xba, 0x4f, 0x17, 0x04, 0x8c, 0x1e, 0x8a, 0xb0,
+    0x24, 0xbb, 0x83, 0xf0, 0x41, 0x87, 0xc1, 0xb6, 0x75, 0x5e, 0x91, 0xee, 0x27, 0x5e, 0x95, 0x8c,
+    0x2e, 0xf9, 0xd3, 0x44, 0x87, 0x8a, 0xe8, 0xe8, 0x40, 0x12, 0x7d, 0x02, 0x74, 0x57, 0x83, 0x1e,
+    0x86, 0x0f, 0xad, 0x50, 0x27, 0xef, 0x88, 0x4c, 0x1c, 0xed, 0xb3, 0xa7, 0x90, 0x2d, 0x86, 0xe3,
+    0xb1, 0x00, 0xf1, 0x7a, 0x43, 0x6f, 0x0b, 0xd8, 0x37, 0xd2, 0x40, 0x09, 0x53, 0xbd, 0xfb, 0xf8,
+    0xfd, 0xc3, 0x17, 0xb2, 0x3f, 0x6a, 0x87, 0xff, 0xf0, 0x4d, 0x86, 0xd3, 0x32, 0xbf, 0x75, 0x47,
+    0x81, 0x80, 0xdd, 0x42, 0xf9, 0xc3, 0x90, 0x88, 0xe9, 0xde, 0x13, 0x4c, 0x7e, 0x18, 0x91, 0xd1,
+    0x8e, 0x98, 0xef, 0x09, 0x58, 0xcd, 0xc0, 0xd9, 0x29, 0xe9, 0x0e, 0x86, 0xa3, 0xdd, 0xbd, 0xfd,
+    0x83, 0x5f, 0x0e, 0xff, 0x41, 0x23, 0x16, 0xf3, 0xe9, 0x6c, 0x9e, 0x5c, 0x5d, 0xa7, 0x8b, 0x2c,
+    0x5f, 0xfe, 0x28, 0xca, 0x6a, 0x75, 0x73, 0x7b, 0xb7, 0xfe, 0xb3, 0x5b, 0x23, 0x1c, 0x13, 0x4c,
+    0x1f, 0x6f, 0x8b, 0x82, 0xae, 0x5d, 0x29, 0x47, 0x51, 0x04, 0x37, 0x37, 0x61, 0x51, 0x00, 0xa5,
+    0x6e, 0x9f, 0xcd, 0x69, 0x71, 0x9c, 0xc7, 0xfc, 0x6d, 0xe5, 0x42, 0x60, 0x4c, 0x21, 0x13, 0xdc,
+    0xdc, 0x90, 0x41, 0x78, 0x73, 0x33, 0x26, 0xff, 0x08, 0x7d, 0xff, 0xe6, 0xc6, 0x13, 0x44, 0x2e,
+    0x8a, 0x02, 0x1d, 0x4d, 0xe1, 0xd1, 0x2d, 0x78, 0x43, 0x81, 0xb8, 0x7b, 0xb0, 0x15, 0xf1, 0xed,
+    0x5f, 0x41, 0xac, 0xc3, 0x31, 0xc9, 0xaa, 0x11, 0xa2, 0xbb, 0xb4, 0x4e, 0x8d, 0x42, 0x25, 0x82,
+    0x26, 0xd0, 0xa3, 0x66, 0x56, 0x04, 0x60, 0x1c, 0x82, 0xb4, 0x2a, 0x02, 0x92, 0x11, 0x49, 0x95,
+    0x9a, 0x0c, 0x44, 0xde, 0x65, 0x28, 0x09, 0xb9, 0x4c, 0xe6, 0x71, 0xef, 0x4d, 0x6f, 0x78, 0xc4,
+    0x0c, 0x32, 0x51, 0xb6, 0x3c, 0xce, 0x97, 0xeb, 0xaf, 0x39, 0x2e, 0x2a, 0xb8, 0x05, 0x62, 0x91,
+    0x08, 0xe4, 0x7e, 0xd5, 0x1b, 0x86, 0x11, 0x84, 0x7c, 0xd8, 0xeb, 0x45, 0x1e, 0xbd, 0x88, 0x2e,
+    0x65, 0x7c, 0x47, 0x97, 0x21, 0xed, 0x57, 0x0a, 0x04, 0x1e, 0x4b, 0xf9, 0x58, 0xda, 0x54, 0x3f,
+    0x40, 0xee, 0x07, 0xbb, 0x23, 0x59, 0x09, 0x49, 0x86, 0xa1, 0x84, 0x23, 0x2e, 0x1d, 0x0f, 0x04,
+    0x23, 0x83, 0x10, 0xcb, 0xd3, 0x64, 0x20, 0x2a, 0xc9, 0xc5, 0xe0, 0x92, 0xd0, 0xba, 0xee, 0xd0,
+    0x31, 0x78, 0x6e, 0x3d, 0xec, 0x0b, 0xcc, 0x93, 0x6f, 0x46, 0x6d, 0xa9, 0x80, 0x2f, 0xb3, 0x9e,
+    0xdc, 0xe0, 0x4a, 0x92, 0x79, 0x51, 0x5c, 0xc2, 0x48, 0x94, 0x1f, 0xc9, 0x82, 0xd2, 0x82, 0x13,
+    0x3d, 0xe6, 0xd1, 0xa8, 0x4f, 0x52, 0x91, 0xa1, 0xac, 0x7a, 0xc3, 0x03, 0x8f, 0x91, 0x3d, 0xb3,
+    0x0e, 0x1e, 0xc2, 0xc0, 0xae, 0x39, 0x80, 0xd5, 0x8e, 0x91, 0x43, 0x6b, 0x08, 0x06, 0x86, 0xe6,
+    0xc0, 0x2e, 0x8e, 0xec, 0x9b, 0x23, 0x7b, 0x30, 0x30, 0x12, 0x03, 0xf7, 0x75, 0x91, 0x3c, 0xa3,
+    0x71, 0x72, 0x27, 0x6b, 0xa4, 0xe4, 0x34, 0x7c, 0xa8, 0x85, 0x54, 0x4a, 0x1b, 0x08, 0xdf, 0x8e,
+    0x09, 0xed, 0xa7, 0x3c, 0x9b, 0x55, 0xf3, 0x80, 0x93, 0x29, 0x05, 0x22, 0xc1, 0x14, 0xa6, 0x74,
+    0x82, 0x8e, 0x8d, 0x8a, 0x88, 0x26, 0x3f, 0xf4, 0xde, 0x50, 0xc8, 0xaf, 0x22, 0x7d, 0x1e, 0x69,
+    0x8f, 0x89, 0x3d, 0x14, 0x71, 0x06, 0x36, 0x10, 0xdd, 0x81, 0xf6, 0xae, 0x18, 0x5a, 0x8a, 0x6e,
+    0xaf, 0xeb, 0x71, 0x52, 0x15, 0x2b, 0x1e, 0xb2, 0x3c, 0xab, 0x92, 0x0c, 0x1e, 0x1e, 0xd4, 0x42,
+    0x88, 0x34, 0x85, 0xae, 0x43, 0x5a, 0x45, 0xb2, 0x27, 0xaa, 0x68, 0x2d, 0xdc, 0xd4, 0x67, 0x13,
+    0x69, 0xa8, 0x77, 0xd2, 0xe8, 0x17, 0xda, 0x8d, 0x2e, 0x7f, 0x12, 0x77, 0xd6, 0x11, 0x69, 0xc9,
+    0x55, 0x10, 0xbd, 0xa9, 0x87, 0xc9, 0x09, 0xaa, 0xc0, 0x34, 0xdc, 0xa0, 0xe8, 0xce, 0x26, 0x13,
+    0x13, 0x4c, 0xa5, 0xe1, 0x4d, 0x8a, 0x33, 0x44, 0x9d, 0xfa, 0x44, 0x58, 0x0c, 0x4a, 0x93, 0x5e,
+    0x7a, 0xda, 0xd3, 0x8f, 0xa2, 0x44, 0xa0, 0x1a, 0x20, 0x75, 0x53, 0x70, 0x24, 0xd0, 0xc3, 0xe1,
+    0xc0, 0x7b, 0x85, 0x3a, 0x52, 0x5a, 0x05, 0x0f, 0x17, 0xc8, 0x96, 0x54, 0x92, 0xdf, 0x16, 0x66,
+    0x71, 0x41, 0x69, 0x18, 0x96, 0xd2, 0xc5, 0xd2, 0x15, 0x8a, 0xe4, 0x9e, 0x91, 0xe1, 0xfe, 0xe7,
+    0xfd, 0xd9, 0xe7, 0x7e, 0xb9, 0x8a, 0x20, 0x9e, 0x10, 0x2e, 0xc0, 0x7f, 0xbc, 0x8d, 0x70, 0x93,
+    0xa8, 0xc2, 0x4a, 0x54, 0x85, 0x4e, 0x47, 0xae, 0x73, 0xaa, 0x0c, 0x29, 0xd9, 0x98, 0x0c, 0x3a,
+    0x1d, 0x9b, 0x2b, 0x42, 0xa8, 0xd7, 0xeb, 0xa9, 0xc0, 0x33, 0x89, 0x7e, 0xcd, 0xb5, 0x1b, 0x0b,
+    0x9b, 0x4a, 0xa2, 0x60, 0x60, 0xe5, 0xf6, 0x60, 0x56, 0x19, 0x41, 0x19, 0x87, 0xea, 0xc5, 0x5d,
+    0xaf, 0x5f, 0x35, 0x08, 0xc2, 0xaf, 0x22, 0x11, 0x89, 0xc2, 0xeb, 0x23, 0xc3, 0xeb, 0x29, 0xba,
+    0x50, 0x64, 0x78, 0x3d, 0x45, 0x17, 0x8f, 0x0c, 0x17, 0xa7, 0xc2, 0xc5, 0x23, 0xc3, 0xc5, 0x29,
+    0xba, 0x78, 0xa4, 0x5c, 0xdc, 0x51, 0x1c, 0x48, 0x9e, 0x73, 0xe5, 0xe7, 0x72, 0x4d, 0x26, 0x0a,
+    0x50, 0x04, 0x8a, 0xc5, 0xf6, 0xa3, 0xf6, 0xe6, 0x6e, 0x37, 0x98, 0xe9, 0xe4, 0x82, 0x60, 0x73,
+    0x6d, 0xcd, 0x9e, 0x3b, 0xdb, 0xd1, 0x36, 0xfe, 0xbb, 0x60, 0x78, 0xd6, 0xeb, 0x4d, 0xa4, 0x17,
+    0xcf, 0xc7, 0x6a, 0x06, 0x2c, 0x1d, 0xcb, 0x34, 0x35, 0x83, 0x26, 0x64, 0xee, 0xe1, 0xbc, 0xf2,
+    0xe8, 0x29, 0xa9, 0x13, 0x2c, 0x84, 0xc0, 0x83, 0x54, 0xf5, 0x4c, 0x44, 0x8c, 0xa0, 0x00, 0x09,
+    0x20, 0x26, 0xae, 0xc2, 0x95, 0xce, 0x3a, 0x57, 0x2e, 0xea, 0x46, 0xbd, 0xb9, 0x17, 0xc6, 0x3f,
+    0x25, 0xe5, 0x5e, 0x0f, 0x69, 0xbb, 0x73, 0xbf, 0xe6, 0x2c, 0x52, 0x3e, 0x6a, 0x10, 0x40, 0x80,
+    0x1e, 0x89, 0x3c, 0xaf, 0x23, 0xfc, 0x73, 0x3e, 0xc6, 0x75, 0x1a, 0x14, 0xc8, 0xa9, 0xb3, 0xf0,
+    0x01, 0xfd, 0x33, 0x06, 0x16, 0x15, 0x87, 0xc2, 0x9b, 0xc0, 0xa3, 0x2d, 0x3e, 0xeb, 0x86, 0xe7,
+    0xcd, 0xf4, 0x08, 0x2a, 0x9a, 0x65, 0xf7, 0x4f, 0xca, 0x9e, 0xca, 0x99, 0x64, 0xe2, 0x7b, 0xc2,
+    0x1d, 0x9b, 0x4c, 0x48, 0x2d, 0x3a, 0x6f, 0xa3, 0xb2, 0x6e, 0xc7, 0x1b, 0xef, 0x79, 0x63, 0xf9,
+    0xcc, 0x11, 0xbe, 0x59, 0x58, 0xc7, 0xf9, 0x62, 0x49, 0x0b, 0x2e, 0x6b, 0x87, 0x51, 0x37, 0xca,
+    0x1e, 0x14, 0x05, 0x91, 0x46, 0x31, 0xd4, 0xea, 0xd4, 0x2b, 0x6d, 0xae, 0x2c, 0x1b, 0x11, 0x06,
+    0x50, 0xd5, 0x06, 0x94, 0xb1, 0x76, 0x2f, 0x3a, 0x8a, 0xea, 0xbc, 0xc6, 0xd0, 0x4a, 0x00, 0xea,
+    0xca, 0x15, 0x2e, 0xd8, 0x65, 0x8f, 0xc2, 0x3f, 0x9e, 0x45, 0x5f, 0x3d, 0xd8, 0x65, 0x01, 0x3a,
+    0x8c, 0x86, 0xbb, 0x61, 0x20, 0x6c, 0x01, 0x29, 0x81, 0x62, 0xdb, 0x7c, 0x20, 0x53, 0x01, 0x85,
+    0x0c, 0x12, 0xf9, 0xe0, 0xfa, 0x22, 0x5d, 0xc8, 0xc9, 0x43, 0x6b, 0xea, 0xd0, 0x98, 0xd9, 0xb3,
+    0x66, 0xf6, 0x8c, 0x99, 0x91, 0x35, 0x33, 0x32, 0x66, 0x86, 0xf6, 0x42, 0x75, 0x0f, 0x6b, 0x97,
+    0xa3, 0x77, 0x49, 0xf5, 0x9b, 0x48, 0xed, 0x6e, 0x13, 0xc4, 0xd5, 0xb8, 0x91, 0x70, 0x10, 0x9a,
+    0xc1, 0x74, 0xf2, 0x6e, 0xc7, 0xd5, 0x89, 0xc1, 0xf3, 0xa5, 0xa0, 0x76, 0xb6, 0xf8, 0xb7, 0x6b,
+    0x27, 0x17, 0x6f, 0x23, 0x11, 0x9d, 0xfc, 0x76, 0x3e, 0x4f, 0xa6, 0x15, 0x9a, 0xaf, 0x29, 0x7e,
+    0xd8, 0x02, 0xb0, 0xa6, 0xfc, 0x33, 0x59, 0xfe, 0x99, 0x17, 0x5d, 0x30, 0x9f, 0x5e, 0x6a, 0xed,
+    0x2b, 0x30, 0xba, 0x01, 0x71, 0x09, 0x8f, 0x51, 0xdd, 0x1a, 0xf8, 0x14, 0x5e, 0xda, 0x9b, 0x83,
+    0x93, 0x33, 0x6b, 0x69, 0xdd, 0x77, 0x00, 0xc5, 0x90, 0x8d, 0x95, 0x87, 0xf8, 0xbe, 0xa0, 0xd9,
+    0x33, 0x56, 0x45, 0xda, 0xa2, 0x09, 0x5d, 0xd0, 0x3b, 0x2d, 0x3c, 0x0d, 0x06, 0xde, 0xd6, 0x75,
+    0x5a, 0x24, 0x24, 0xf4, 0xef, 0x3a, 0x04, 0x65, 0x41, 0xd5, 0x31, 0xcc, 0xc4, 0x3b, 0x97, 0x5d,
+    0x31, 0xc4, 0xbd, 0x78, 0x9d, 0x9a, 0x7b, 0x48, 0xfa, 0x5a, 0xa7, 0x1f, 0xc8, 0x50, 0xda, 0x55,
+    0xc7, 0xcc, 0xd3, 0x0a, 0x0e, 0xe6, 0x42, 0x2f, 0xf3, 0x46, 0x7d, 0x73, 0xa9, 0x9c, 0xb9, 0x77,
+    0x1f, 0x5d, 0xcc, 0xfd, 0xa9, 0x0f, 0x29, 0x5c, 0x1a, 0x69, 0x0e, 0xf9, 0x21, 0xf6, 0x7e, 0xce,
+    0xc2, 0x59, 0x3d, 0xd0, 0xe1, 0x90, 0x68, 0xb0, 0x35, 0x13, 0x24, 0xa6, 0x26, 0x36, 0x20, 0x0b,
+    0xd5, 0x5e, 0x4c, 0xb1, 0xdc, 0x1a, 0x1a, 0x06, 0x8a, 0xa6, 0xec, 0x51, 0x5d, 0x97, 0x1e, 0xfe,
+    0x66, 0xaa, 0xc1, 0xd6, 0xb6, 0x81, 0x20, 0x35, 0xd2, 0x2a, 0x22, 0x06, 0x0a, 0x53, 0x45, 0xb5,
+    0x42, 0x24, 0xec, 0x45, 0x74, 0x73, 0xa2, 0x5a, 0x11, 0x4b, 0x93, 0xbc, 0xd6, 0x64, 0xac, 0x54,
+    0x57, 0x6b, 0x32, 0xc2, 0x26, 0x4e, 0x19, 0x11, 0xe4, 0x0e, 0xb5, 0xbd, 0x67, 0x84, 0x81, 0x00,
+    0xb3, 0xc6, 0xe2, 0x33, 0x54, 0xd4, 0xac, 0xc7, 0x64, 0x05, 0xd6, 0xa9, 0x18, 0xb7, 0x8a, 0x3c,
+    0x14, 0x13, 0x97, 0x4d, 0x6e, 0x8f, 0x43, 0x9d, 0x3d, 0x23, 0xed, 0xf3, 0x06, 0x1e, 0xb8, 0xbd,
+    0x42, 0xab, 0xb5, 0x05, 0x16, 0x36, 0x14, 0x64, 0xea, 0xe7, 0x5c, 0x64, 0x48, 0xc3, 0x47, 0x06,
+    0x41, 0x0c, 0x7f, 0xd5, 0x01, 0xc2, 0x22, 0xc9, 0xa0, 0x4b, 0xaa, 0x02, 0xa5, 0x0a, 0x95, 0x94,
+    0xd8, 0x98, 0x43, 0xbd, 0xf0, 0xad, 0x7c, 0x14, 0x62, 0x94, 0x40, 0x03, 0x13, 0xd7, 0xf5, 0x3c,
+    0x9e, 0x4c, 0xac, 0x66, 0x04, 0xe8, 0x8c, 0xb5, 0x4a, 0xe3, 0x1e, 0xc1, 0x3c, 0xa9, 0xc9, 0xd5,
+    0xc3, 0x7e, 0xe3, 0xef, 0x4f, 0x92, 0x53, 0x80, 0xe8, 0xf3, 0xb2, 0xf6, 0xd4, 0xef, 0x9a, 0x24,
+    0xd5, 0xcb, 0xbc, 0x80, 0x98, 0x64, 0xe6, 0x01, 0x9d, 0xc3, 0x8d, 0xcd, 0xfe, 0x3c, 0xc6, 0x4e,
+    0x5c, 0x21, 0xab, 0x36, 0xdc, 0x8f, 0xeb, 0x6a, 0x2f, 0xf5, 0x2f, 0x29, 0x0b, 0x5d, 0x6f, 0x55,
+    0xf2, 0xe9, 0x2a, 0xad, 0x92, 0x65, 0xba, 0xb6, 0x35, 0x2d, 0x28, 0x52, 0x2c, 0x3f, 0x01, 0xf6,
+    0xb6, 0xe2, 0x49, 0xb9, 0x13, 0xc3, 0x32, 0x01, 0x14, 0xb9, 0x1f, 0xc3, 0x93, 0x2e, 0x05, 0x1c,
+    0x4b, 0x41, 0x74, 0xc1, 0x31, 0x20, 0xd0, 0x8f, 0x38, 0xfc, 0xe4, 0xe3, 0x58, 0xb8, 0x0f, 0xc7,
+    0x09, 0x1f, 0xf0, 0x2e, 0x01, 0x99, 0x2e, 0x5c, 0x30, 0x23, 0x00, 0x06, 0x51, 0xc0, 0x83, 0x41,
+    0xc0, 0xd0, 0x76, 0x91, 0xe8, 0xa4, 0x23, 0xb3, 0x7f, 0x93, 0x3a, 0x7b, 0x85, 0xe2, 0x6f, 0xe9,
+    0xe4, 0x22, 0xfb, 0xec, 0x0a, 0x1d, 0xe6, 0xc7, 0xaa, 0xad, 0xf0, 0x35, 0xdc, 0x43, 0x9a, 0x01,
+    0xce, 0x47, 0x3b, 0x91, 0xc1, 0xb9, 0x28, 0x62, 0x54, 0x66, 0x49, 0x99, 0x3f, 0x07, 0x90, 0xed,
+    0x22, 0x91, 0x28, 0x30, 0xd9, 0xdd, 0xcb, 0xa8, 0x8a, 0x90, 0x73, 0x16, 0x60, 0x3a, 0x0d, 0x68,
+    0x30, 0xda, 0x61, 0xc0, 0xfb, 0x50, 0x70, 0x0a, 0x3d, 0x2c, 0xf3, 0x01, 0xfe, 0xd2, 0x57, 0x40,
+    0xfe, 0x10, 0xe6, 0x1b, 0x40, 0x1f, 0x1b, 0xa9, 0x48, 0xc6, 0x81, 0xe7, 0x4d, 0x00, 0xe8, 0xe4,
+    0x1b, 0x54, 0x1d, 0x85, 0xd4, 0x13, 0xef, 0xa1, 0x7a, 0xc5, 0x54, 0x34, 0x94, 0x0d, 0x08, 0xc5,
+    0x56, 0x13, 0x18, 0xa3, 0xa2, 0x6a, 0xf8, 0xdb, 0x18, 0xa0, 0x42, 0x75, 0xb4, 0xdd, 0xb8, 0x27,
+    0xc9, 0xcd, 0x19, 0x5f, 0x48, 0xd3, 0x06, 0xb5, 0x28, 0xda, 0x9e, 0xe8, 0x27, 0x66, 0x29, 0x33,
+    0xf3, 0x45, 0x0d, 0xc1, 0x01, 0x22, 0x46, 0x87, 0x95, 0x2d, 0x81, 0xd8, 0xad, 0x36, 0x7b, 0xb8,
+    0x81, 0x4c, 0x48, 0x6a, 0x5c, 0xf6, 0xe0, 0x72, 0xdf, 0xca, 0x9a, 0x3d, 0x93, 0xec, 0xf6, 0x05,
+    0x04, 0x53, 0xcd, 0x90, 0xcc, 0x44, 0xe2, 0x59, 0xb7, 0x95, 0x65, 0x30, 0x17, 0xbe, 0xde, 0x9c,
+    0x63, 0x61, 0xd2, 0x92, 0x15, 0x34, 0xbe, 0x88, 0x85, 0x16, 0xc4, 0x6a, 0x09, 0x36, 0x8f, 0x71,
+    0x3f, 0xd5, 0xd9, 0x33, 0x09, 0xf0, 0xf0, 0xcd, 0x7c, 0x67, 0x75, 0xdf, 0xa7, 0xb9, 0x11, 0x10,
+    0x0d, 0x67, 0x0f, 0xf2, 0x5c, 0x6c, 0xaa, 0x7a, 0xd9, 0x6b, 0x32, 0xbd, 0xb8, 0x02, 0xf2, 0x48,
+    0xfd, 0x9a, 0xd8, 0xfa, 0x48, 0xc9, 0xf5, 0x0e, 0x66, 0x4c, 0xc1, 0xd0, 0x07, 0xa8, 0xe9, 0xae,
+    0x7b, 0x05, 0x9d, 0xc3, 0x1b, 0xc4, 0x18, 0x41, 0xbe, 0x93, 0xe3, 0xa3, 0xa3, 0x81, 0x14, 0x6a,
+    0x21, 0x39, 0xff, 0xf0, 0xed, 0x75, 0x1a, 0x64, 0xc4, 0x44, 0x84, 0x81, 0x9c, 0xd4, 0xef, 0x23,
+    0x01, 0xbd, 0xc4, 0x68, 0x0a, 0x7e, 0x90, 0x65, 0xef, 0x2a, 0x28, 0x88, 0x3e, 0xd5, 0xf5, 0xde,
+    0x08, 0xc5, 0x40, 0xa3, 0x35, 0xed, 0xc7, 0xb5, 0x58, 0x3f, 0x82, 0x42, 0x2a, 0x1b, 0xe4, 0xd0,
+    0x0d, 0x5e, 0xe1, 0x89, 0x3e, 0x99, 0x5d, 0x30, 0xb9, 0x45, 0x83, 0xba, 0xaf, 0x82, 0xa3, 0x10,
+    0x4a, 0x30, 0x02, 0xe7, 0xf3, 0xa7, 0xf7, 0x06, 0xb1, 0x2b, 0x24, 0x56, 0x28, 0xd8, 0x29, 0x2a,
+    0x50, 0x86, 0x03, 0x68, 0x64, 0x7c, 0xe5, 0x4d, 0x2f, 0xa6, 0x92, 0x5e, 0xb3, 0x85, 0xfd, 0x51,
+    0x6f, 0x61, 0x21, 0x11, 0x31, 0xe8, 0xb5, 0x97, 0xb0, 0xed, 0xb9, 0x56, 0xbd, 0xe8, 0xc9, 0xe9,
+    0x91, 0x51, 0xac, 0xd8, 0xc5, 0xf2, 0x72, 0x67, 0xe1, 0xe3, 0x4f, 0x74, 0xdc, 0xdc, 0xdb, 0xc9,
+    0x64, 0x9c, 0xe0, 0x84, 0x0f, 0x4a, 0x17, 0x29, 0xa0, 0x0c, 0x58, 0xf0, 0x03, 0x5c, 0xf8, 0x0a,
+    0x1a, 0xf9, 0x12, 0x7a, 0x8d, 0x4d, 0x49, 0x2d, 0x41, 0x54, 0xe6, 0x04, 0xfc, 0x71, 0xaf, 0x57,
+    0x7a, 0xb6, 0x90, 0x0f, 0x86, 0x67, 0xde, 0xb3, 0x7e, 0x5c, 0x34, 0x42, 0x46, 0x72, 0x4f, 0xfd,
+    0x8a, 0xcc, 0x9f, 0xcc, 0x21, 0xa0, 0x3d, 0x72, 0x05, 0x2b, 0x1a, 0xe9, 0x07, 0x9d, 0x8c, 0xf5,
+    0x0b, 0xcb, 0xa7, 0xd4, 0xf6, 0xbc, 0x9d, 0x12, 0x13, 0xbc, 0x18, 0xc1, 0x77, 0x9a, 0xc7, 0x9b,
+    0x67, 0x1f, 0x4d, 0x64, 0xf5, 0xe3, 0x26, 0x32, 0x91, 0x71, 0xc5, 0xa9, 0xee, 0xb3, 0x3b, 0x9d,
+    0xc8, 0xb0, 0xf2, 0xc6, 0x82, 0xb8, 0x79, 0xa2, 0x26, 0xff, 0x2d, 0x6d, 0x2b, 0xec, 0x66, 0xcb,
+    0x32, 0x61, 0xf5, 0x31, 0xcf, 0x82, 0x98, 0x3b, 0x0b, 0x76, 0x9c, 0x67, 0x37, 0xbc, 0xa8, 0xd4,
+    0xbe, 0x94, 0xe2, 0x92, 0x3f, 0x7f, 0x52, 0x63, 0x49, 0x89, 0x24, 0xbc, 0x4b, 0xef, 0x4c, 0xfa,
+    0x0b, 0x10, 0x48, 0x8d, 0x5b, 0x9b, 0x48, 0x8b, 0xf2, 0x19, 0xd7, 0x84, 0xdb, 0x67, 0xe3, 0x15,
+    0xe3, 0x38, 0x4b, 0x1b, 0x0d, 0x48, 0x9a, 0x52, 0x0d, 0xd6, 0x59, 0x1a, 0x83, 0xda, 0xd4, 0xe4,
+    0x2e, 0x60, 0xa0, 0x29, 0x55, 0xe2, 0x32, 0x44, 0x20, 0x16, 0x92, 0xa4, 0xa5, 0x7c, 0x76, 0xfe,
+    0xa3, 0xd0, 0xf5, 0x0c, 0x84, 0xd3, 0x55, 0x21, 0xb2, 0x51, 0xd0, 0xf2, 0x4a, 0x4f, 0xc6, 0x11,
+    0x28, 0x93, 0xaa, 0x21, 0x5a, 0x47, 0xe1, 0x63, 0x90, 0x82, 0x4b, 0x08, 0x29, 0x6b, 0x2b, 0x00,
+    0x2e, 0x40, 0x94, 0xb8, 0x2d, 0x00, 0x0b, 0x14, 0x8c, 0x48, 0xf9, 0x5a, 0xa6, 0x4b, 0x64, 0x9f,
+    0x48, 0x29, 0x42, 0x33, 0x9f, 0x7f, 0xcc, 0x6e, 0x4e, 0x92, 0x59, 0x52, 0x59, 0x5b, 0x91, 0x61,
+    0xb3, 0x13, 0x69, 0x0e, 0x2f, 0xa0, 0xb5, 0x93, 0xb5, 0xa9, 0x33, 0xf4, 0x88, 0xb9, 0x59, 0x91,
+    0xfe, 0x48, 0x3b, 0xbb, 0xb0, 0xd7, 0x73, 0xa3, 0x1d, 0x77, 0xd4, 0x03, 0x98, 0xc1, 0xdd, 0xd4,
+    0xdb, 0xc1, 0x4d, 0x31, 0x3c, 0x6c, 0x8c, 0x37, 0x13, 0xc6, 0x8c, 0xab, 0xe6, 0xe4, 0xac, 0x7e,
+    0xf4, 0xf4, 0x53, 0x0d, 0x48, 0x77, 0x22, 0xd5, 0x8c, 0x7e, 0xf3, 0x3c, 0xfd, 0xa4, 0xcf, 0x3e,
+    0xa3, 0x89, 0xde, 0xcb, 0x9e, 0x7c, 0x83, 0x6d, 0x65, 0xcf, 0xf4, 0xdf, 0xd3, 0x3c, 0xab, 0x66,
+    0xf9, 0x82, 0x17, 0x6b, 0xcb, 0x85, 0xe5, 0xc3, 0x12, 0xea, 0x44, 0x52, 0x6b, 0x42, 0x0f, 0xa6,
+    0x44, 0x3d, 0xe8, 0xcb, 0x1d, 0xf5, 0x3a, 0xd7, 0xe3, 0xe2, 0x76, 0x47, 0x3c, 0xaf, 0x16, 0x22,
+    0x33, 0x83, 0xe3, 0x43, 0x85, 0x19, 0xee, 0xe3, 0x21, 0x92, 0x82, 0xae, 0xf0, 0x00, 0x9c, 0x5a,
+    0xc7, 0x38, 0x0b, 0x60, 0xc5, 0x88, 0x17, 0x33, 0x9e, 0xa9, 0x0e, 0xe6, 0x3a, 0x75, 0x49, 0x2a,
+    0x90, 0xd3, 0x23, 0x6c, 0x6a, 0x5a, 0x5d, 0x5c, 0x46, 0x3a, 0x7d, 0x51, 0x98, 0x2b, 0x72, 0x4f,
+    0xc7, 0x3a, 0x32, 0xd8, 0x84, 0x9d, 0xcd, 0x9f, 0x2a, 0x79, 0x8f, 0x3d, 0x7f, 0x2b, 0x1d, 0x1d,
+    0xa0, 0x32, 0xe5, 0x62, 0x63, 0x4c, 0xb4, 0x6a, 0x64, 0x33, 0x22, 0xeb, 0x42, 0x73, 0x26, 0x0d,
+    0x7d, 0xdb, 0x58, 0x8b, 0x0d, 0x0d, 0x53, 0xb3, 0xa1, 0xbb, 0x88, 0xac, 0x7b, 0xb6, 0x18, 0xea,
+    0xc6, 0x8e, 0xb6, 0x15, 0x54, 0xd1, 0xe6, 0x6d, 0xee, 0xbb, 0x08, 0x2c, 0x6e, 0xcc, 0x6a, 0x08,
+    0xb5, 0x7d, 0x5b, 0x2d, 0xe4, 0x8d, 0x9b, 0xd7, 0xa1, 0xd8, 0x1c, 0x33, 0x12, 0xf9, 0xf5, 0x62,
+    0xd8, 0xb4, 0xa9, 0xe6, 0x7a, 0xa1, 0xfa, 0xca, 0x00, 0x93, 0xc5, 0x20, 0xd0, 0x20, 0xba, 0x72,
+    0x20, 0xe4, 0x04, 0xbc, 0x46, 0x35, 0x5e, 0x97, 0x3d, 0xf1, 0x0c, 0x04, 0xa0, 0xc1, 0xbb, 0xf4,
+    0x7d, 0xa8, 0x21, 0x4d, 0x03, 0x45, 0x8d, 0x0a, 0x52, 0x9b, 0x93, 0x2a, 0xa3, 0xb5, 0x66, 0x48,
+    0x6a, 0x9c, 0xe5, 0x80, 0x95, 0xad, 0x1c, 0x86, 0x4a, 0x7d, 0x71, 0x36, 0xb2, 0xb0, 0xfe, 0x8f,
+    0xc9, 0xaf, 0x89, 0x98, 0x96, 0x64, 0x66, 0xf8, 0x70, 0xd8, 0x0a, 0xa8, 0x52, 0x5a, 0xe3, 0x4a,
+    0xdb, 0xc0, 0x44, 0x62, 0x6b, 0x3c, 0xa5, 0x1d, 0x4c, 0xa6, 0xb7, 0x5a, 0x88, 0x76, 0x20, 0x99,
+    0xe4, 0x6a, 0xfd, 0xd8, 0x79, 0xae, 0x7c, 0x7f, 0xc3, 0xb3, 0xe6, 0xec, 0xab, 0x3e, 0x7a, 0xf5,
+    0xde, 0xb8, 0x2a, 0xbb, 0x41, 0x5e, 0x3b, 0x92, 0xe5, 0x12, 0xf3, 0x9b, 0xdd, 0xf6, 0xbe, 0xbf,
+    0x5b, 0x4a, 0x75, 0xcb, 0x7b, 0x0c, 0x7d, 0x49, 0x39, 0x85, 0x1a, 0xd7, 0x64, 0x4b, 0xbb, 0x37,
+    0x52, 0xdb, 0x03, 0xd9, 0x91, 0xc6, 0xea, 0x27, 0x27, 0x91, 0x56, 0xa1, 0x58, 0xd6, 0x0b, 0x44,
+    0xcf, 0x2a, 0xce, 0xae, 0x20, 0x65, 0x98, 0x1d, 0xa5, 0x7d, 0x17, 0x1b, 0x49, 0xe9, 0xa0, 0x29,
+    0x88, 0xd5, 0x16, 0xa1, 0x83, 0x09, 0x07, 0x52, 0x24, 0xee, 0xcb, 0xa4, 0x7e, 0x5c, 0xbc, 0xdc,
+    0x55, 0x57, 0xfa, 0xea, 0x6e, 0x80, 0x81, 0x7f, 0xc7, 0x61, 0x4c, 0x66, 0xcd, 0xf1, 0x62, 0xa4,
+    0x4c, 0xe3, 0x3e, 0xee, 0x2e, 0xbe, 0xe4, 0xb7, 0xe2, 0x1a, 0xc5, 0xba, 0x22, 0xa1, 0xe3, 0xd1,
+    0xfe, 0xc1, 0xcf, 0x9f, 0x51, 0x3f, 0x51, 0x2a, 0xc4, 0x96, 0x9b, 0xdf, 0xd6, 0x0d, 0x41, 0xa4,
+    0x6a, 0xb7, 0x1c, 0x35, 0xd2, 0x6c, 0x93, 0x13, 0x84, 0x56, 0xb9, 0x50, 0xe1, 0x46, 0x0f, 0x69,
+    0x3a, 0x16, 0x0a, 0x4e, 0xea, 0x6b, 0xaa, 0xf6, 0xeb, 0x44, 0xb5, 0x4b, 0x20, 0xcd, 0xbd, 0xd3,
+    0x76, 0x38, 0x79, 0xf0, 0x4d, 0xac, 0xeb, 0x9f, 0x76, 0x68, 0x11, 0xa8, 0x44, 0x1f, 0xd9, 0xb7,
+    0xc3, 0xd4, 0x19, 0x99, 0x98, 0x27, 0x6a, 0x5b, 0x60, 0x0b, 0x13, 0xf6, 0xec, 0x49, 0x58, 0x93,
+    0xec, 0xd3, 0x54, 0x4d, 0xa2, 0x4f, 0xd3, 0x14, 0xc9, 0x83, 0xe8, 0xf3, 0x8e, 0x76, 0x98, 0x26,
+    0xfa, 0x89, 0xb5, 0x67, 0xdf, 0x42, 0x51, 0xe5, 0x18, 0x62, 0xec, 0x89, 0xb7, 0xc8, 0xae, 0x2a,
+    0x14, 0x31, 0x36, 0x8b, 0xed, 0x90, 0xba, 0xe0, 0x12, 0xa3, 0x0d, 0xd9, 0x02, 0x29, 0x3c, 0x8f,
+    0xd4, 0x61, 0xdc, 0x0e, 0x05, 0x0e, 0x46, 0x64, 0xa8, 0xb6, 0xcf, 0xeb, 0xab, 0x10, 0xd2, 0x5c,
+    0xa3, 0xb4, 0x03, 0xca, 0x83, 0x70, 0xa2, 0x4f, 0xdd, 0xdb, 0x81, 0xa0, 0x4e, 0x13, 0x71, 0x9e,
+    0xbe, 0xc5, 0xa5, 0x74, 0x5a, 0x27, 0xc6, 0xf1, 0x79, 0x3b, 0x68, 0xa4, 0x8f, 0x83, 0x89, 0x71,
+    0x34, 0xbc, 0xc5, 0x68, 0x79, 0x4c, 0x44, 0xa4, 0x6e, 0x9d, 0x96, 0x21, 0x4c, 0x8c, 0x70, 0xde,
+    0xbc, 0x26, 0x20, 0x78, 0x85, 0x3a, 0xb0, 0x6e, 0x0f, 0x20, 0x5b, 0x89, 0x51, 0xd8, 0xfc, 0x37,
+    0xc7, 0x89, 0x6f, 0x0b, 0x36, 0xcd, 0x57, 0x85, 0xab, 0x9a, 0xa5, 0x44, 0xdf, 0x50, 0x5e, 0xe9,
+    0x87, 0x73, 0xeb, 0x42, 0xbe, 0x49, 0x25, 0x6f, 0xcf, 0x8e, 0xf7, 0x92, 0x2c, 0x69, 0x7a, 0x07,
+    0xfc, 0xec, 0x44, 0x94, 0x77, 0x59, 0xda, 0x21, 0x9d, 0x88, 0xaa, 0x2e, 0x89, 0xe0, 0x6d, 0x73,
+    0x14, 0x32, 0xd5, 0x00, 0xd8, 0x10, 0xf7, 0x0c, 0x2a, 0xbc, 0x5f, 0xc3, 0xf9, 0x50, 0xd3, 0xff,
+    0xae, 0xaf, 0x45, 0x2f, 0xbd, 0xce, 0x68, 0x7f, 0x3f, 0x54, 0xc7, 0xba, 0x38, 0x1d, 0x36, 0x04,
+    0xd5, 0x13, 0xab, 0xc7, 0x18, 0x9e, 0x5a, 0x3d, 0x3c, 0x16, 0xc4, 0xe6, 0x3a, 0xe3, 0x77, 0x95,
+    0xbe, 0x63, 0x09, 0x15, 0xb0, 0x2c, 0x14, 0x89, 0x3f, 0x94, 0xeb, 0x29, 0x4c, 0x39, 0x7a, 0xa5,
+    0x79, 0x93, 0x30, 0x8a, 0x25, 0x4a, 0xec, 0xd1, 0xd0, 0x7e, 0xb5, 0x66, 0xaf, 0xec, 0xd9, 0x2b,
+    0xbc, 0x19, 0x37, 0x93, 0xe6, 0xf9, 0x85, 0x4b, 0xdb, 0x16, 0xb9, 0x0c, 0x1f, 0x94, 0x7d, 0xac,
+    0x80, 0x82, 0x60, 0xd2, 0xda, 0x0f, 0x1f, 0xcf, 0xa3, 0x78, 0x44, 0xcb, 0xd9, 0x54, 0xc7, 0x65,
+    0x91, 0xcd, 0xbe, 0x83, 0x29, 0xcb, 0x4a, 0x5e, 0x31, 0x19, 0x1f, 0x6b, 0xd5, 0x3e, 0x20, 0xcf,
+    0x37, 0x10, 0x70, 0x59, 0x26, 0x7f, 0x72, 0xbc, 0x11, 0x0f, 0xff, 0xa6, 0x87, 0x04, 0x62, 0x58,
+    0x03, 0xe4, 0x79, 0xda, 0xbc, 0x2c, 0xab, 0xa2, 0x59, 0x49, 0x00, 0x73, 0x1e, 0x7f, 0x4f, 0xe4,
+    0xf7, 0x02, 0x1a, 0xfc, 0x42, 0x83, 0x42, 0x27, 0xf8, 0x6f, 0xd8, 0x49, 0xa0, 0x16, 0xdb, 0xe7,
+    0x5c, 0x71, 0x65, 0xf3, 0x0c, 0xc0, 0xf0, 0xe0, 0x39, 0x88, 0xd1, 0x9e, 0x84, 0x80, 0xf2, 0xa6,
+    0xe7, 0x26, 0xa4, 0x96, 0xce, 0xd3, 0x63, 0xbd, 0x66, 0xcc, 0xf0, 0x94, 0x5a, 0x8a, 0x2a, 0x59,
+    0x08, 0x7d, 0x99, 0x52, 0xa1, 0xd6, 0x4e, 0xe4, 0xd5, 0xeb, 0x8c, 0x57, 0x5f, 0x05, 0x84, 0x27,
+    0x0e, 0xac, 0x34, 0x37, 0xea, 0x44, 0xa6, 0x16, 0xde, 0x8a, 0x22, 0xbd, 0xb2, 0xfa, 0x0a, 0x40,
+    0x5c, 0x9b, 0xdd, 0x26, 0x59, 0x9c, 0xdf, 0xf6, 0x59, 0xb1, 0x5e, 0x56, 0x79, 0xa7, 0x63, 0xbd,
+    0xe2, 0x22, 0x67, 0x14, 0x06, 0x16, 0xdf, 0x68, 0xba, 0xe2, 0xa5, 0x74, 0xde, 0x15, 0x15, 0x44,
+    0x7f, 0x07, 0x86, 0x0e, 0x25, 0xe5, 0xdd, 0x11, 0x34, 0x14, 0x4f, 0x21, 0xba, 0x2b, 0x2a, 0x3f,
+    0x62, 0x11, 0x5f, 0x22, 0x8c, 0x77, 0x47, 0x10, 0x80, 0x95, 0xd7, 0xa6, 0x41, 0xb2, 0xa2, 0x17,
+    0xd5, 0xa5, 0x10, 0xa9, 0xed, 0x6b, 0xac, 0xfa, 0x2b, 0xa9, 0x4e, 0xc7, 0x9a, 0xfe, 0xc6, 0x8b,
+    0x12, 0xb4, 0x37, 0xee, 0xee, 0x77, 0x37, 0x64, 0x90, 0x3c, 0xff, 0x49, 0x6c, 0xfe, 0x0a, 0xc1,
+    0x9c, 0x60, 0xbc, 0x61, 0xeb, 0x4f, 0x15, 0xfc, 0xdb, 0x99, 0xfb, 0xd3, 0xfc, 0x2c, 0xa6, 0x92,
+    0x56, 0x56, 0x37, 0xc0, 0x1a, 0x6c, 0xdc, 0x18, 0xfa, 0xbe, 0x32, 0xef, 0x44, 0x0e, 0xf6, 0xf7,
+    0x77, 0x0f, 0x76, 0xc4, 0x80, 0x5a, 0xdd, 0xf3, 0x5a, 0x9d, 0x88, 0x54, 0x13, 0x70, 0xc3, 0x2d,
+    0x53, 0x72, 0x49, 0xc3, 0x90, 0x1b, 0xfe, 0xb2, 0xe1, 0x49, 0x60, 0x87, 0xef, 0xd1, 0x5a, 0x04,
+    0x9e, 0x72, 0x12, 0x11, 0x4e, 0xa6, 0x97, 0x98, 0xc8, 0x0d, 0xc0, 0x46, 0xd8, 0x36, 0x33, 0x22,
+    0x0f, 0xd4, 0xee, 0x26, 0xd5, 0xb7, 0xc1, 0x4e, 0xa3, 0x06, 0x80, 0x68, 0x74, 0xaa, 0xa7, 0x1e,
+    0xab, 0xf6, 0xd2, 0x40, 0xc4, 0xb4, 0xa9, 0x72, 0x44, 0xb3, 0xa6, 0x4c, 0x9d, 0x5b, 0x64, 0x6b,
+    0x6e, 0x66, 0x8d, 0x24, 0x4f, 0x9b, 0x75, 0xd5, 0x47, 0x47, 0xb6, 0x3a, 0x0c, 0x5a, 0xe7, 0x9c,
+    0xad, 0x0a, 0x7e, 0xa6, 0x6c, 0x72, 0xff, 0x60, 0xbe, 0x6f, 0xe4, 0xb7, 0x77, 0xb8, 0x9c, 0x45,
+    0xa9, 0x34, 0x6a, 0x1a, 0x94, 0xe1, 0x92, 0xcb, 0xc2, 0x27, 0xbb, 0xdc, 0xf6, 0x0f, 0x53, 0x37,
+    0xbe, 0x61, 0x4d, 0x93, 0x8c, 0x47, 0xc5, 0xb5, 0x79, 0x9b, 0xd1, 0xed, 0xaa, 0x1d, 0xa8, 0x3e,
+    0xcf, 0x8c, 0xfd, 0x46, 0x22, 0xa8, 0x5b, 0x3e, 0x11, 0x5b, 0x38, 0xf9, 0x29, 0x2d, 0xf4, 0xe5,
+    0x30, 0xed, 0xf9, 0xdd, 0x3f, 0xb2, 0x6e, 0x18, 0xfb, 0x50, 0xee, 0xb4, 0xfe, 0x98, 0x6f, 0x83,
+    0xd5, 0x14, 0xcc, 0xce, 0x1c, 0x64, 0x18, 0xfd, 0xca, 0xef, 0xf4, 0xd1, 0xda, 0x78, 0x70, 0x37,
+    0x6c, 0x3e, 0xf8, 0x18, 0x74, 0x81, 0x44, 0xfd, 0x91, 0xc7, 0xf0, 0x60, 0xe3, 0x20, 0xcd, 0x9e,
+    0x6a, 0x88, 0x2e, 0xaf, 0x59, 0x39, 0x5c, 0xd2, 0x78, 0x54, 0xef, 0x6a, 0x1a, 0xf6, 0xfd, 0xe1,
+    0x10, 0xb6, 0x87, 0x29, 0x6e, 0x11, 0xba, 0xa7, 0xbc, 0x2c, 0xe9, 0x8c, 0x3b, 0x55, 0x9e, 0x3b,
+    0x69, 0x9e, 0xcd, 0x1c, 0xb0, 0x9f, 0x73, 0x76, 0xfe, 0xb6, 0x5b, 0xf7, 0xf6, 0xe8, 0xa6, 0xb2,
+    0x3a, 0xb0, 0x47, 0x1f, 0xe8, 0x35, 0x1f, 0x31, 0xc1, 0xde, 0x46, 0xe9, 0x09, 0x76, 0x33, 0x9d,
+    0x0e, 0x1e, 0xd4, 0xdc, 0xcb, 0xbb, 0x01, 0xeb, 0x3b, 0xb6, 0xb8, 0xd7, 0x93, 0x57, 0x04, 0xe3,
+    0xe1, 0xe8, 0xd0, 0xc3, 0x43, 0x61, 0x70, 0x0b, 0x5e, 0xdf, 0x41, 0xb9, 0x7c, 0x32, 0x1c, 0xfd,
+    0xe2, 0x75, 0x3a, 0x00, 0x30, 0x1a, 0xec, 0x1d, 0x7a, 0x78, 0x50, 0x2d, 0x60, 0x5c, 0xde, 0x39,
+    0xd8, 0xf5, 0x7e, 0x02, 0x56, 0x58, 0x8f, 0x4c, 0x26, 0x07, 0x30, 0xf2, 0x8f, 0x91, 0x3a, 0xb9,
+    0xdf, 0x0e, 0x29, 0x41, 0xdb, 0x08, 0x0c, 0x47, 0xde, 0xcf, 0xd1, 0x68, 0x0f, 0x36, 0x4f, 0x6a,
+    0x70, 0xa0, 0xef, 0x19, 0x40, 0x52, 0xdb, 0x2b, 0x43, 0xb9, 0xe1, 0x32, 0x55, 0x20, 0x25, 0x8e,
+    0x26, 0x23, 0xef, 0x7e, 0x86, 0x17, 0xa3, 0xda, 0x57, 0xc4, 0x0b, 0x6c, 0xea, 0xa6, 0x8d, 0xc7,
+    0xba, 0x33, 0x4f, 0xaf, 0x8b, 0xb3, 0xa1, 0x5e, 0x6f, 0x14, 0xd6, 0x0b, 0xb7, 0xbb, 0xaa, 0xb5,
+    0x89, 0x03, 0xc3, 0xfc, 0x27, 0x5f, 0xeb, 0x8e, 0x2d, 0x13, 0x29, 0x44, 0xf6, 0x17, 0x5c, 0x37,
+    0x3d, 0xb1, 0x31, 0xb8, 0x34, 0x9e, 0x7f, 0x18, 0xcf, 0xf1, 0x62, 0x39, 0xb4, 0x5e, 0x7f, 0x98,
+    0xaf, 0x2c, 0xe7, 0xd3, 0xa9, 0x7c, 0xb7, 0x56, 0x3e, 0xe7, 0xd5, 0x97, 0x55, 0x94, 0xe2, 0x11,
+    0xb1, 0xde, 0x28, 0xbf, 0x52, 0x9f, 0x94, 0x47, 0xfa, 0x41, 0xbb, 0xc3, 0x44, 0x1c, 0x54, 0xe9,
+    0xe7, 0x9a, 0x5f, 0x3b, 0x3c, 0xd1, 0x63, 0x15, 0xf3, 0x62, 0x02, 0x47, 0x23, 0x31, 0x2a, 0x3f,
+    0x13, 0x53, 0x2e, 0x0a, 0x5b, 0x07, 0x9a, 0x26, 0x31, 0xb2, 0xe0, 0x2c, 0x05, 0x03, 0xce, 0x35,
+    0x5f, 0x77, 0x37, 0xf4, 0x72, 0x92, 0x6b, 0xe6, 0x9a, 0x73, 0xe4, 0xa6, 0x5f, 0x96, 0xed, 0x1c,
+    0x97, 0xa7, 0x3c, 0xd9, 0x06, 0xea, 0xfb, 0x4c, 0x94, 0xa4, 0xe6, 0x28, 0xcc, 0x0c, 0x1e, 0x89,
+    0x99, 0x35, 0x4d, 0xbc, 0xeb, 0xf9, 0xbf, 0x78, 0x93, 0xc9, 0xae, 0x17, 0x36, 0x1f, 0xd5, 0x7b,
+    0x66, 0xac, 0x18, 0xd7, 0xa1, 0xb1, 0x66, 0x4a, 0x9e, 0xe0, 0xb1, 0x2d, 0xd0, 0x31, 0xde, 0xe9,
+    0x98, 0x71, 0x8c, 0xa1, 0x10, 0x2b, 0xf5, 0xd9, 0xa7, 0xb1, 0xb1, 0x15, 0xfe, 0x98, 0x1d, 0xa0,
+    0xed, 0x95, 0x6e, 0x61, 0xee, 0xd1, 0xd4, 0xba, 0xc4, 0x50, 0x4c, 0xf8, 0x08, 0xaa, 0xd4, 0x06,
+    0x25, 0xa6, 0x75, 0x1f, 0xc3, 0x71, 0xa9, 0x1f, 0xd2, 0xa8, 0x4a, 0xb6, 0x86, 0x11, 0x2d, 0xf9,
+    0xf7, 0x55, 0x91, 0x92, 0xee, 0xbc, 0xaa, 0x96, 0x47, 0xaf, 0x5f, 0x43, 0x2c, 0xf6, 0x87, 0x07,
+    0x87, 0xfd, 0x41, 0x7f, 0xf8, 0x5a, 0xe6, 0xcf, 0x8c, 0x57, 0xb7, 0x79, 0x71, 0xfd, 0x3d, 0x4d,
+    0x4a, 0x79, 0x6f, 0x26, 0x0d, 0xf8, 0x1d, 0x0c, 0x28, 0x5b, 0xc8, 0x52, 0x76, 0x32, 0xda, 0xb1,
+    0xc5, 0x20, 0xb4, 0x17, 0xd9, 0xbb, 0x55, 0x55, 0xe5, 0x19, 0x89, 0x73, 0xb6, 0x5a, 0xf0, 0xac,
+    0xc2, 0x6e, 0xe6, 0x7d, 0xca, 0xf1, 0xf1, 0xdd, 0xfa, 0x63, 0xec, 0x76, 0x11, 0xa6, 0x17, 0x09,
+    0xa0, 0xae, 0xba, 0xa8, 0xcd, 0xb3, 0x8c, 0xb3, 0xea, 0x39, 0x44, 0x05, 0xb6, 0x89, 0xbb, 0x5c,
+    0x3f, 0x8f, 0xb8, 0x5c, 0xdb, 0x58, 0xe5, 0x3c, 0xbf, 0x7d, 0x96, 0x4f, 0x80, 0xb1, 0xb1, 0x62,
+    0x7e, 0x93, 0x30, 0xfe, 0xf1, 0x64, 0x3b, 0x8e, 0x84, 0xe8, 0x25, 0xb1, 0x2d, 0xd9, 0x87, 0xbc,
+    0x58, 0x3c, 0x2f, 0x17, 0xe4, 0xef, 0x85, 0xc2, 0x6b, 0x74, 0xfd, 0x9d, 0xd1, 0x34, 0x8d, 0x28,
+    0xbb, 0x26, 0xf7, 0xe5, 0x8a, 0x31, 0xc8, 0xf9, 0x47, 0x3a, 0x00, 0xd0, 0xeb, 0x01, 0xb7, 0xcc,
+    0x53, 0xde, 0x4f, 0xf3, 0x99, 0xdb, 0xfd, 0x52, 0x87, 0xd8, 0x91, 0x83, 0xb5, 0x07, 0x5c, 0xb7,
+    0x21, 0x04, 0xd9, 0x3c, 0x0a, 0xc1, 0x68, 0x8d, 0xef, 0xb8, 0xcd, 0xa4, 0x51, 0xe9, 0xf6, 0x0f,
+    0x83, 0xfd, 0x43, 0x1f, 0x3f, 0xab, 0x0d, 0x5a, 0xe7, 0x77, 0x87, 0x87, 0x01, 0xfc, 0xf5, 0x0f,
+    0xb0, 0x77, 0x0e, 0x78, 0x51, 0xe4, 0x85, 0xc1, 0x11, 0xa6, 0x17, 0x93, 0x27, 0x5a, 0xf7, 0xb6,
+    0x2a, 0x25, 0x7c, 0x9d, 0xf3, 0x82, 0x3b, 0xb7, 0xb4, 0x74, 0x28, 0xec, 0x6e, 0xf2, 0x08, 0x14,
+    0xe1, 0x4c, 0x79, 0xc5, 0xe6, 0x40, 0xdb, 0x49, 0x16, 0xcb, 0xbc, 0xa8, 0x68, 0x56, 0x39, 0x49,
+    0x86, 0xda, 0xa0, 0x22, 0xce, 0xf1, 0xc0, 0xc8, 0x59, 0xc3, 0x5e, 0x47, 0x19, 0xa0, 0xef, 0x7c,
+    0x49, 0x39, 0x38, 0xb0, 0x73, 0xc3, 0x8b, 0x64, 0xba, 0x96, 0x53, 0x4a, 0x89, 0x00, 0x1f, 0xc0,
+    0xf6, 0x8c, 0x43, 0x93, 0xc3, 0xd3, 0x9c, 0xc6, 0x62, 0xab, 0x06, 0xbd, 0xc5, 0x8c, 0xf7, 0x31,
+    0xed, 0x3c, 0x18, 0x76, 0xfc, 0x9e, 0xc4, 0xcf, 0x28, 0x57, 0xdd, 0x9e, 0xf4, 0x93, 0x38, 0xd4,
+    0xa6, 0xef, 0xdf, 0x60, 0x4b, 0x8e, 0x6d, 0xc2, 0x4b, 0x44, 0x57, 0x0d, 0xc9, 0xf1, 0xe7, 0xd3,
+    0xd3, 0xdf, 0x3f, 0x7d, 0x3c, 0x7e, 0xfb, 0xf5, 0xe3, 0xe7, 0x4f, 0xdf, 0xdf, 0x9f, 0x9d, 0x7d,
+    0x3e, 0xeb, 0x6e, 0x52, 0x64, 0x9a, 0x39, 0x0c, 0x0f, 0x52, 0x53, 0xdd, 0xb0, 0xf0, 0x39, 0x4c,
+    0x66, 0xa0, 0xa9, 0x7e, 0xbf, 0xff, 0x0a, 0xe4, 0x89, 0x93, 0x92, 0x82, 0x06, 0xa5, 0x27, 0xe3,
+    0x15, 0x7e, 0x13, 0x7f, 0xd0, 0x69, 0x66, 0xbc, 0xf8, 0xf5, 0xeb, 0xe9, 0x6f, 0xc4, 0xc4, 0xea,
+    0x86, 0x56, 0xb0, 0x99, 0x50, 0xc7, 0x72, 0x02, 0x38, 0x7b, 0xce, 0x51, 0xe3, 0xe4, 0xa6, 0xeb,
+    0xf5, 0xcb, 0x6a, 0x9d, 0xe2, 0x99, 0x52, 0xb9, 0x4c, 0xe9, 0x9a, 0x74, 0xb3, 0x3c, 0xe3, 0x4f,
+    0xe0, 0xaa, 0x74, 0x52, 0x3e, 0x85, 0x8c, 0xfb, 0x1e, 0xfe, 0x03, 0x76, 0x3c, 0x50, 0x4c, 0x54,
+    0x82, 0xf2, 0x65, 0xba, 0xa0, 0xcb, 0x6e, 0x80, 0x0f, 0xb5, 0xc1, 0xc0, 0x96, 0xb5, 0xb6, 0x9e,
+    0xb1, 0xa2, 0x99, 0xc8, 0xb0, 0xf5, 0x03, 0x8c, 0x32, 0xb4, 0xb4, 0xfa, 0x11, 0x5a, 0xa7, 0x55,
+    0x16, 0x1f, 0xa9, 0xe0, 0x8b, 0xc8, 0x0b, 0xa5, 0x08, 0x23, 0x53, 0x7f, 0x5d, 0xcc, 0xfd, 0xe6,
+    0x62, 0x4d, 0x11, 0x6d, 0xbe, 0xad, 0xc3, 0xaf, 0x4d, 0x5a, 0x60, 0x42, 0xe6, 0xfb, 0xde, 0x7d,
+    0x59, 0x26, 0xd0, 0x03, 0x18, 0xb3, 0x17, 0xec, 0xb2, 0x8f, 0x83, 0x16, 0xbb, 0x1b, 0x00, 0x5e,
+    0x48, 0xe3, 0xf8, 0xfb, 0x6d, 0x32, 0x4d, 0xbe, 0xe7, 0x4b, 0x21, 0x73, 0x14, 0x20, 0x8e, 0xf7,
+    0x17, 0xed, 0x18, 0xa5, 0x39, 0xbb, 0xee, 0xaa, 0x3a, 0x6e, 0x09, 0x38, 0x5e, 0x3a, 0x0c, 0x0f,
+    0x96, 0xc9, 0x1f, 0xc2, 0x28, 0xe8, 0x51, 0x3d, 0x11, 0x04, 0x7f, 0x74, 0x27, 0x9f, 0x72, 0x5d,
+    0x30, 0x4a, 0xa9, 0xcc, 0xfe, 0xf8, 0xf5, 0x72, 0xd2, 0x6d, 0x09, 0x93, 0x2d, 0x1e, 0xed, 0x48,
+    0x38, 0x48, 0x5b, 0xde, 0x8b, 0x9d, 0xe8, 0x85, 0xbc, 0xd9, 0x4b, 0xd4, 0x8c, 0x15, 0x7c, 0x46,
+    0x8b, 0x38, 0xb5, 0xdc, 0x05, 0x6c, 0xd0, 0x1a, 0x41, 0x67, 0xbc, 0x87, 0x54, 0xba, 0x21, 0xcf,
+    0xec, 0x80, 0xfb, 0x8b, 0xfe, 0xae, 0x95, 0xfc, 0xa0, 0xab, 0xc4, 0x34, 0x99, 0x41, 0xc3, 0x4a,
+    0x4c, 0x35, 0x51, 0xa8, 0xe3, 0xfc, 0x06, 0x08, 0x9e, 0xf0, 0x29, 0x5d, 0xa5, 0x95, 0xab, 0xbd,
+    0x13, 0x77, 0x4f, 0x25, 0x4f, 0xc1, 0x82, 0xb0, 0xf7, 0x54, 0xeb, 0xd4, 0x9f, 0x3c, 0x6d, 0x65,
+    0x68, 0x09, 0xda, 0x01, 0x48, 0xa8, 0x4c, 0x32, 0xe3, 0xa0, 0xb7, 0xbe, 0x82, 0x94, 0x65, 0xa7,
+    0x67, 0x95, 0x59, 0x25, 0x79, 0x48, 0xd1, 0x8a, 0xfc, 0xab, 0x66, 0x53, 0x21, 0x7f, 0x0f, 0x41,
+    0x7d, 0x7d, 0x78, 0x9f, 0xc4, 0x77, 0x47, 0x03, 0xe1, 0x6f, 0x47, 0x91, 0x70, 0xd5, 0x60, 0x79,
+    0x1b, 0x1f, 0x61, 0x99, 0x51, 0xad, 0x07, 0x74, 0xc1, 0x41, 0xc9, 0x19, 0xce, 0x72, 0x16, 0xb0,
+    0x39, 0x3c, 0xb0, 0xf9, 0xc3, 0xf6, 0x2c, 0x74, 0xce, 0xb3, 0x18, 0x6d, 0xc5, 0x0a, 0x1e, 0x03,
+    0xef, 0x09, 0xac, 0x26, 0xd2, 0xd6, 0xa3, 0x54, 0x67, 0x7b, 0xd1, 0x63, 0x2c, 0x2c, 0x81, 0xff,
+    0x71, 0xfe, 0xf9, 0x53, 0x5f, 0xd6, 0x2d, 0x28, 0x14, 0x6e, 0x0c, 0x25, 0x6b, 0x99, 0x97, 0x2d,
+    0x49, 0xa6, 0xb6, 0x80, 0xc8, 0x34, 0x71, 0x50, 0xbf, 0x3f, 0x4a, 0x38, 0x8f, 0x67, 0x5e, 0x50,
+    0x98, 0x8f, 0x1b, 0xb6, 0xa0, 0x2e, 0x31, 0x9e, 0xdc, 0xf0, 0x18, 0xeb, 0xd1, 0xf6, 0x5c, 0xdc,
+    0x86, 0x80, 0x6a, 0xd8, 0xca, 0xbe, 0x08, 0x68, 0x64, 0x5e, 0x9a, 0xe4, 0x21, 0x50, 0x63, 0xa6,
+    0x00, 0xcf, 0x96, 0x2c, 0xac, 0x01, 0x52, 0x3a, 0x15, 0x8e, 0x8e, 0x88, 0xc7, 0x47, 0x15, 0xbc,
+    0xd6, 0x82, 0x2c, 0xd0, 0x2c, 0x5f, 0x2c, 0x60, 0xab, 0x05, 0xae, 0x01, 0x5b, 0xa8, 0x38, 0x70,
+    0xd8, 0x9c, 0xb3, 0x6b, 0xa8, 0xbc, 0xb4, 0xc2, 0xda, 0xec, 0x50, 0x20, 0x57, 0x56, 0x49, 0x9a,
+    0x3a, 0xb7, 0x1c, 0xfe, 0x51, 0x8c, 0x71, 0xa8, 0xcd, 0x39, 0x96, 0x6a, 0x07, 0x2f, 0x76, 0x20,
+    0x6c, 0x9d, 0x7f, 0x25, 0x1f, 0x12, 0x67, 0x9e, 0x57, 0xe5, 0x32, 0x07, 0xd7, 0x03, 0x7a, 0xe0,
+    0x71, 0xc5, 0xfa, 0x49, 0x3d, 0x9d, 0x21, 0xc4, 0xe3, 0xa8, 0x6c, 0xe2, 0xca, 0x52, 0xc1, 0x0b,
+    0x2c, 0xf5, 0xb6, 0xaa, 0xf8, 0x02, 0xd2, 0x28, 0xf8, 0x12, 0x70, 0xa7, 0x08, 0x68, 0x46, 0x59,
+    0x9a, 0xaf, 0x9e, 0xb6, 0x5b, 0x2b, 0xba, 0x30, 0x9c, 0xad, 0xc3, 0xff, 0xc6, 0x96, 0x05, 0xe5,
+    0xc6, 0x4e, 0x74, 0x95, 0xc6, 0x4e, 0x96, 0xdf, 0x82, 0x8e, 0x68, 0x51, 0x39, 0x53, 0x48, 0x63,
+    0xa2, 0x19, 0x9a, 0x15, 0x1c, 0xda, 0x18, 0xd4, 0x03, 0x95, 0x54, 0xb7, 0x72, 0xe4, 0x7c, 0xc5,
+    0x26, 0x67, 0x55, 0xae, 0x40, 0xce, 0xb5, 0x53, 0xd1, 0x6b, 0x0e, 0xdd, 0x55, 0x94, 0xaf, 0x2a,
+    0x67, 0x34, 0x80, 0x50, 0x06, 0x9c, 0xb8, 0x0c, 0x1c, 0x3a, 0xad, 0x78, 0xe1, 0xc0, 0x36, 0x97,
+    0xcd, 0x9d, 0xa4, 0x72, 0x6e, 0xd1, 0x20, 0x65, 0x9a, 0xdf, 0x02, 0xca, 0x72, 0x25, 0x6e, 0x09,
+    0xd7, 0x34, 0x13, 0x87, 0x08, 0xc3, 0x1a, 0x0b, 0xd7, 0x01, 0xc6, 0x13, 0x46, 0x2b, 0x8e, 0x48,
+    0xb0, 0x4c, 0x6d, 0x3e, 0xd5, 0x67, 0xb1, 0x35, 0x4b, 0xf1, 0xf7, 0x82, 0x8a, 0x7c, 0x35, 0x9b,
+    0x3b, 0x65, 0xbe, 0x40, 0xef, 0x00, 0xb6, 0x8a, 0xd2, 0x89, 0x38, 0x50, 0x83, 0x39, 0x48, 0x1b,
+    0x28, 0x50, 0x3e, 0x9d, 0xd6, 0xf6, 0x16, 0x72, 0xdd, 0xd2, 0x44, 0xa8, 0x0a, 0xd7, 0x4c, 0x32,
+    0x88, 0xd3, 0x95, 0x30, 0x4a, 0xf9, 0xca, 0xf9, 0x23, 0xc3, 0xff, 0x3e, 0x1a, 0xf0, 0xe8, 0x5b,
+    0xa5, 0xa9, 0x01, 0x97, 0xf7, 0x67, 0xce, 0x6d, 0x81, 0x07, 0x1f, 0x3a, 0xb5, 0x79, 0x82, 0x25,
+    0xd5, 0xde, 0x49, 0x01, 0x85, 0x36, 0x95, 0x2a, 0x71, 0x99, 0x03, 0x43, 0x21, 0xaa, 0x4d, 0xc4,
+    0x0b, 0x57, 0x24, 0x5c, 0x2b, 0x3e, 0x82, 0xec, 0xd8, 0x77, 0xfe, 0x85, 0xe7, 0x01, 0x4a, 0x66,
+    0x6b, 0x2a, 0x10, 0x4e, 0x0d, 0xd5, 0x40, 0x13, 0xd8, 0xb0, 0x89, 0xe5, 0xc6, 0x80, 0x3f, 0xe3,
+    0xe0, 0x1e, 0xa0, 0xbf, 0x52, 0xf9, 0xb4, 0xdd, 0x96, 0x0a, 0xac, 0x62, 0xed, 0xd0, 0x19, 0x4d,
+    0x32, 0xd1, 0xa3, 0xbe, 0x28, 0x4a, 0xc5, 0x82, 0xcf, 0xc6, 0xa8, 0x80, 0x7a, 0x71, 0x74, 0xfe,
+    0xff, 0x05, 0xa6, 0x9d, 0xcc, 0x37, 0xba, 0x5d, 0x83, 0xa0, 0x82, 0x8b, 0xe5, 0x6f, 0xe6, 0x18,
+    0xa5, 0xd9, 0x9e, 0x90, 0x44, 0xad, 0xb5, 0x5e, 0x40, 0x53, 0x16, 0xb2, 0x36, 0xa2, 0xaa, 0xc4,
+    0xc9, 0x0f, 0xac, 0xec, 0xe6, 0x8a, 0xd8, 0x66, 0xd9, 0xa8, 0xb9, 0x50, 0x7e, 0xc0, 0xd0, 0xaa,
+    0xec, 0x42, 0x5f, 0xf9, 0xe9, 0xcb, 0xef, 0x5f, 0x51, 0x4b, 0x7d, 0xdc, 0x8c, 0x93, 0x6e, 0x41,
+    0xe3, 0x24, 0x87, 0x0e, 0xbc, 0xde, 0x44, 0x30, 0xd8, 0x5a, 0x88, 0x1f, 0x19, 0x1e, 0xd0, 0x77,
+    0xb1, 0x7e, 0x76, 0xe5, 0x97, 0x89, 0x65, 0x29, 0xce, 0xec, 0x35, 0x8a, 0xac, 0xb6, 0xdb, 0xd6,
+    0x39, 0xf9, 0xf8, 0x0d, 0x37, 0x03, 0x8f, 0xf0, 0x44, 0xef, 0x01, 0xe3, 0x74, 0xb9, 0x84, 0xfa,
+    0x78, 0x0c, 0x0e, 0x1d, 0xe3, 0xa1, 0x94, 0x3c, 0xdc, 0xdb, 0x46, 0x2c, 0xa5, 0x11, 0x4f, 0xbb,
+    0xf8, 0x05, 0xed, 0xbc, 0x5a, 0xa4, 0xb0, 0x73, 0x05, 0x06, 0xb9, 0x61, 0xda, 0x68, 0x83, 0x20,
+    0x17, 0x5f, 0x46, 0x19, 0x03, 0xb1, 0x2e, 0x95, 0x6d, 0x7d, 0x8a, 0x69, 0x17, 0xdd, 0x15, 0x53,
+    0xfc, 0xa4, 0xb9, 0xb5, 0x2b, 0xa6, 0xed, 0x5d, 0x31, 0x55, 0x5d, 0x31, 0x7e, 0xd2, 0xbc, 0xa5,
+    0xdd, 0x11, 0x1d, 0x70, 0x5f, 0xb8, 0x3a, 0x8f, 0xeb, 0x53, 0x1b, 0x9b, 0x48, 0x53, 0x26, 0x96,
+    0x6b, 0x93, 0x2f, 0x15, 0x4a, 0xb0, 0x3b, 0x85, 0xa4, 0x8b, 0xd1, 0xb6, 0x5c, 0x8b, 0xc4, 0x93,
+    0x26, 0xcb, 0x28, 0x87, 0x96, 0xf1, 0xc8, 0x39, 0xae, 0x8a, 0xd4, 0xf1, 0x9d, 0xe3, 0xc0, 0x79,
+    0x8f, 0xbf, 0xd6, 0x0e, 0x1d, 0x83, 0xb5, 0x99, 0xd3, 0x0a, 0xa8, 0xf2, 0xd9, 0x2c, 0xe5, 0xe7,
+    0xf3, 0xfc, 0xd6, 0x24, 0x2f, 0x45, 0x7e, 0x41, 0x9f, 0x16, 0x26, 0xd9, 0x72, 0x55, 0x7d, 0x45,
+    0xd7, 0xa1, 0xc2, 0x83, 0xc4, 0xa7, 0xaa, 0xf5, 0x18, 0x21, 0x06, 0xec, 0x7d, 0x73, 0xa2, 0x61,
+    0x86, 0xe1, 0xaf, 0x49, 0x0c, 0xfb, 0x2a, 0xaa, 0xfc, 0xaf, 0xe2, 0x77, 0x95, 0xea, 0xec, 0xb7,
+    0xc0, 0x23, 0xaf, 0x0d, 0x7c, 0x4d, 0x5e, 0x6b, 0xaa, 0xd9, 0xa0, 0xb5, 0xc6, 0x01, 0x1e, 0x07,
+    0xfd, 0xd7, 0xe9, 0x6f, 0xbf, 0x56, 0xd5, 0x52, 0xf7, 0x28, 0xe8, 0xfc, 0x39, 0xf8, 0x86, 0xdb,
+    0xfd, 0xe7, 0xfb, 0xaf, 0xdd, 0x80, 0x06, 0x18, 0xb0, 0x22, 0x22, 0x92, 0x05, 0x87, 0x0a, 0x45,
+    0x0e, 0x07, 0x83, 0x01, 0x7e, 0xfe, 0x0b, 0xee, 0x23, 0x81, 0x33, 0x70, 0xc7, 0x78, 0x2d, 0x6e,
+    0x2e, 0xd8, 0x9c, 0x66, 0x33, 0x6e, 0xea, 0x4e, 0x7c, 0x11, 0x2d, 0x00, 0xce, 0xe5, 0x4d, 0xcc,
+    0x1e, 0xfe, 0x46, 0x5a, 0xa4, 0x26, 0x10, 0x69, 0x55, 0x12, 0x32, 0x1a, 0xc8, 0x5f, 0x27, 0x84,
+    0x9e, 0x53, 0xd6, 0x7b, 0xaf, 0x7e, 0x72, 0x45, 0x4b, 0x28, 0xce, 0x2c, 0x05, 0x25, 0x48, 0x69,
+    0x59, 0xc9, 0xbf, 0x82, 0x62, 0xea, 0x5f, 0x71, 0x15, 0x88, 0x22, 0xb5, 0x7a, 0xea, 0x67, 0x4d,
+    0x3a, 0xd8, 0x40, 0x11, 0xe7, 0x88, 0xfd, 0x66, 0x23, 0xe1, 0x99, 0x2f, 0x32, 0xdd, 0x49, 0xc5,
+    0x19, 0x6d, 0x9b, 0xa5, 0xb9, 0xe6, 0x33, 0xfd, 0x8d, 0x56, 0x35, 0xd2, 0x61, 0xda, 0xaa, 0x53,
+    0xae, 0x74, 0xfa, 0xe5, 0xf3, 0xb9, 0xa1, 0x54, 0x5e, 0x2b, 0x15, 0xff, 0x27, 0x1b, 0xa1, 0x38,
+    0x25, 0x54, 0x38, 0xbf, 0x82, 0xca, 0x78, 0x21, 0x2a, 0x47, 0x05, 0x9e, 0xd6, 0x43, 0x07, 0xea,
+    0x06, 0x5d, 0xf9, 0xa1, 0x09, 0x74, 0x1d, 0xaf, 0xf1, 0xb4, 0xa5, 0x17, 0xd3, 0x8a, 0x8a, 0xc8,
+    0x17, 0xd6, 0x88, 0xc5, 0x3a, 0xcf, 0x99, 0x83, 0x3f, 0x36, 0x07, 0x53, 0x13, 0x9b, 0xe6, 0x60,
+    0xb5, 0x39, 0x58, 0x9b, 0x39, 0xf8, 0x56, 0x73, 0x30, 0x65, 0x0e, 0xf5, 0xb3, 0x26, 0x1d, 0xf0,
+    0xc7, 0xe6, 0x60, 0xa6, 0x39, 0x58, 0x8b, 0x39, 0x00, 0xc6, 0xc8, 0xf9, 0x90, 0xde, 0xf1, 0xab,
+    0x95, 0xea, 0x37, 0x48, 0x09, 0x58, 0xa7, 0xb1, 0x5a, 0xe8, 0x03, 0xc5, 0x47, 0x93, 0xb0, 0x73,
+    0x4e, 0x13, 0xd8, 0xb7, 0x05, 0x08, 0xe3, 0x85, 0x46, 0x08, 0x6d, 0x85, 0x6c, 0x52, 0x80, 0x75,
+    0x38, 0xb3, 0x15, 0x1e, 0x61, 0xea, 0xb2, 0x8a, 0xc7, 0x86, 0x2d, 0xa0, 0xe5, 0x2a, 0x5a, 0x24,
+    0x55, 0xb7, 0xd9, 0xa4, 0x18, 0xaa, 0x32, 0xd7, 0xa8, 0x2a, 0xca, 0xe6, 0x02, 0xd7, 0x96, 0xaa,
+    0x19, 0x77, 0xbb, 0x79, 0xb6, 0x55, 0xa4, 0x56, 0xb0, 0x6d, 0xf2, 0xb4, 0x02, 0xb7, 0x08, 0x63,
+    0xc3, 0xb5, 0x49, 0xd2, 0x7a, 0x08, 0xd4, 0x9c, 0xab, 0x06, 0x8f, 0x0f, 0xef, 0xbc, 0xf6, 0x83,
+    0x23, 0x79, 0x7a, 0xd9, 0xc3, 0x0b, 0x87, 0xa0, 0xe5, 0x3c, 0xd5, 0x0b, 0xff, 0x17, 0x98, 0xad,
+    0xb8, 0xd0, 0xfd, 0x47, 0x00, 0x00,
+};
@@ -0,0 +1,21 @@
+// Generated by python/softapPages.py from softap/: do not edit
+
+#ifndef wifi_pages_h
+#define wifi_pages_h
+
+#include "wifi-setup.h"
+
+PageHandler statusPage;
+extern const uint8_t index_html_gz[1040];
+extern const uint8_t setup_js_gz[6182];
+
+#define NUM_WIFI_ROUTES     4
+
+constexpr Page wifiRoutes[NUM_WIFI_ROUTES] = {
+    { "/index", 301, "text/plain", nullptr, 0, "Location: /index.html\r\n", nullptr, false },
+    { "/index.html", 200, "text/html", index_html_gz, 1040, "Content-Encoding: gzip\r\nContent-Length: 1040\r\nETag: \"56914da70d019159\"\r\nCache-Control: no-cache\r\n", nullptr, false },
+    { "/setup.js", 200, "application/javascript", setup_js_gz, 6182, "Content-Encoding: gzip\r\nContent-Length: 6182\r\nETag: \"81df73db2f280b98\"\r\nCache-Control: public, max-age=604800\r\n", nullptr, false },
+    { "/status/", 200, nullptr, nullptr, 0, nullptr, statusPage, true },
+};
+
+#endif
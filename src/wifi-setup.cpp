@@ -31,112 +31,249 @@
  
 
 #include "wifi-setup.h"
+#include "wifi-pages.h"
+#include "boot.h"
+#include "profile.h"
 
-const char index_html[] = "<!DOCTYPE html><html><head><meta name='viewport' content='width=device-width, initial-scale=1'><title>Setup your device</title><link rel='stylesheet' type='text/css' href='style.css'></head><body><h2>Connect your lamp to a WiFi network to control it</h2><h3>Device ID:</h3><input type=text id='device-id' size='25' value='' disabled/><button type='button' class='input-helper' id='copy-button'>Copy</button><div id='scan-div'><h3>Scan for visible WiFi networks</h3><button id='scan-button' type='button'>Scan</button></div><div id='networks-div'></div><div id='connect-div' style='display: none'><p>Don't see your network? Move me closer to your router, then re-scan.</p><form id='connect-form'><input type='password' id='password' size='25' placeholder='password'/><button type='button' class='input-helper' id='show-button'>Show</button><button type='submit' id='connect-button'>Connect</button></form></div><script src='rsa-utils/jsbn_1.js'></script><script src='rsa-utils/jsbn_2.js'></script><script src='rsa-utils/prng4.js'></script><script src='rsa-utils/rng.js'></script><script src='rsa-utils/rsa.js'></script><script src='script.js'></script></body></html>";
+#include <stdio.h>
 
-const char rsa_js[] = "function parseBigInt(a,b){return new BigInteger(a,b);}function linebrk(a,b){var c='';var d=0;while(d+b<a.length){c+=a.substring(d,d+b)+'\\n';d+=b;}return c+a.substring(d,a.length);}function byte2Hex(a){if(a<0x10)return '0'+a.toString(16);else return a.toString(16);}function pkcs1pad2(a,b){if(b<a.length+11){alert('Message too long for RSA');return null;}var c=new Array();var d=a.length-1;while(d>=0&&b>0){var e=a.charCodeAt(d--);if(e<128)c[--b]=e;else if((e>127)&&(e<2048)){c[--b]=(e&63)|128;c[--b]=(e>>6)|192;}else{c[--b]=(e&63)|128;c[--b]=((e>>6)&63)|128;c[--b]=(e>>12)|224;}}c[--b]=0;var f=new SecureRandom();var g=new Array();while(b>2){g[0]=0;while(g[0]==0)f.nextBytes(g);c[--b]=g[0];}c[--b]=2;c[--b]=0;return new BigInteger(c);}function RSAKey(){this.n=null;this.e=0;this.d=null;this.p=null;this.q=null;this.dmp1=null;this.dmq1=null;this.coeff=null;}function RSASetPublic(a,b){if(a!=null&&b!=null&&a.length>0&&b.length>0){this.n=parseBigInt(a,16);this.e=parseInt(b,16);}else alert('Invalid RSA public key');}function RSADoPublic(a){return a.modPowInt(this.e,this.n);}function RSAEncrypt(a){var b=pkcs1pad2(a,(this.n.bitLength()+7)>>3);if(b==null)return null;var c=this.doPublic(b);if(c==null)return null;var d=c.toString(16);if((d.length&1)==0)return d;else return '0'+d;}RSAKey.prototype.doPublic=RSADoPublic;RSAKey.prototype.setPublic=RSASetPublic;RSAKey.prototype.encrypt=RSAEncrypt;";
-
-const char style_css[] = "html{height:100%;margin:auto;background-color:white}body{box-sizing:border-box;min-height:100%;padding:20px;background-color:#1aabe0;font-family:'Lucida Sans Unicode','Lucida Grande',sans-serif;font-weight:normal;color:white;margin-top:0;margin-left:auto;margin-right:auto;margin-bottom:0;max-width:400px;text-align:center;border:1px solid #6e6e70;border-radius:4px}div{margin-top:25px;margin-bottom:25px}h1{margin-top:25px;margin-bottom:25px}button{border-color:#1c75be;background-color:#1c75be;color:white;border-radius:5px;height:30px;font-size:15px;font-weight:bold}button.input-helper{background-color:#bebebe;border-color:#bebebe;color:#6e6e70;margin-left:3px}button:disabled{background-color:#bebebe;border-color:#bebebe;color:white}input[type='text'],input[type='password']{background-color:white;color:#6e6e70;border-color:white;border-radius:5px;height:25px;text-align:center;font-size:15px}input:disabled{background-color:#bebebe;border-color:#bebebe}input[type='radio']{position:relative;bottom:-0.33em;margin:0;border:0;height:1.5em;width:15%}label{padding-top:7px;padding-bottom:7px;padding-left:5%;display:inline-block;width:80%;text-align:left}input[type='radio']:checked+label{font-weight:bold;color:#1c75be}.scanning-error{font-weight:bold;text-align:center}.radio-div{box-sizing:border-box;margin:2px;margin-left:auto;margin-right:auto;background-color:white;color:#6e6e70;border:1px solid #6e6e70;border-radius:3px;width:100%;padding:5px}#networks-div{margin-left:auto;margin-right:auto;text-align:left}#device-id{text-align:center}#scan-button{min-width:100px}#connect-button{display:block;min-width:100px;margin-top:10px;margin-left:auto;margin-right:auto;margin-bottom:20px}#password{margin-top:20px;margin-bottom:10px}";
-
-const char rng_js[] = "var rng_state;var rng_pool;var rng_pptr;function rng_seed_int(a){rng_pool[rng_pptr++]^=a&255;rng_pool[rng_pptr++]^=(a>>8)&255;rng_pool[rng_pptr++]^=(a>>16)&255;rng_pool[rng_pptr++]^=(a>>24)&255;if(rng_pptr>=rng_psize)rng_pptr-=rng_psize;}function rng_seed_time(){rng_seed_int(new Date().getTime());}if(rng_pool==null){rng_pool=new Array();rng_pptr=0;var t;if(window.crypto&&window.crypto.getRandomValues){var ua=new Uint8Array(32);window.crypto.getRandomValues(ua);for(t=0;t<32;++t)rng_pool[rng_pptr++]=ua[t];}if(navigator.appName=='Netscape'&&navigator.appVersion<'5'&&window.crypto){var z=window.crypto.random(32);for(t=0;t<z.length;++t)rng_pool[rng_pptr++]=z.charCodeAt(t)&255;}while(rng_pptr<rng_psize){t=Math.floor(65536*Math.random());rng_pool[rng_pptr++]=t>>>8;rng_pool[rng_pptr++]=t&255;}rng_pptr=0;rng_seed_time();}function rng_get_byte(){if(rng_state==null){rng_seed_time();rng_state=prng_newstate();rng_state.init(rng_pool);for(rng_pptr=0;rng_pptr<rng_pool.length;++rng_pptr)rng_pool[rng_pptr]=0;rng_pptr=0;}return rng_state.next();}function rng_get_bytes(a){var b;for(b=0;b<a.length;++b)a[b]=rng_get_byte();}function SecureRandom(){}SecureRandom.prototype.nextBytes=rng_get_bytes;";
-
-const char jsbn_2_js[] = "function bnpRShiftTo(a,b){b.s=this.s;var c=Math.floor(a/this.DB);if(c>=this.t){b.t=0;return;}var d=a%this.DB;var e=this.DB-d;var f=(1<<d)-1;b[0]=this[c]>>d;for(var g=c+1;g<this.t;++g){b[g-c-1]|=(this[g]&f)<<e;b[g-c]=this[g]>>d;}if(d>0)b[this.t-c-1]|=(this.s&f)<<e;b.t=this.t-c;b.clamp();}function bnpSubTo(a,b){var c=0,d=0,e=Math.min(a.t,this.t);while(c<e){d+=this[c]-a[c];b[c++]=d&this.DM;d>>=this.DB;}if(a.t<this.t){d-=a.s;while(c<this.t){d+=this[c];b[c++]=d&this.DM;d>>=this.DB;}d+=this.s;}else{d+=this.s;while(c<a.t){d-=a[c];b[c++]=d&this.DM;d>>=this.DB;}d-=a.s;}b.s=(d<0)?-1:0;if(d<-1)b[c++]=this.DV+d;else if(d>0)b[c++]=d;b.t=c;b.clamp();}function bnpMultiplyTo(a,b){var c=this.abs(),d=a.abs();var e=c.t;b.t=e+d.t;while(--e>=0)b[e]=0;for(e=0;e<d.t;++e)b[e+c.t]=c.am(0,d[e],b,e,0,c.t);b.s=0;b.clamp();if(this.s!=a.s)BigInteger.ZERO.subTo(b,b);}function bnpSquareTo(a){var b=this.abs();var c=a.t=2*b.t;while(--c>=0)a[c]=0;for(c=0;c<b.t-1;++c){var d=b.am(c,b[c],a,2*c,0,1);if((a[c+b.t]+=b.am(c+1,2*b[c],a,2*c+1,d,b.t-c-1))>=b.DV){a[c+b.t]-=b.DV;a[c+b.t+1]=1;}}if(a.t>0)a[a.t-1]+=b.am(c,b[c],a,2*c,0,1);a.s=0;a.clamp();}function bnpDivRemTo(a,b,c){var d=a.abs();if(d.t<=0)return;var e=this.abs();if(e.t<d.t){if(b!=null)b.fromInt(0);if(c!=null)this.copyTo(c);return;}if(c==null)c=nbi();var f=nbi(),g=this.s,h=a.s;var i=this.DB-nbits(d[d.t-1]);if(i>0){d.lShiftTo(i,f);e.lShiftTo(i,c);}else{d.copyTo(f);e.copyTo(c);}var j=f.t;var k=f[j-1];if(k==0)return;var l=k*(1<<this.F1)+((j>1)?f[j-2]>>this.F2:0);var m=this.FV/l,n=(1<<this.F1)/l,o=1<<this.F2;var p=c.t,q=p-j,r=(b==null)?nbi():b;f.dlShiftTo(q,r);if(c.compareTo(r)>=0){c[c.t++]=1;c.subTo(r,c);}BigInteger.ONE.dlShiftTo(j,r);r.subTo(f,f);while(f.t<j)f[f.t++]=0;while(--q>=0){var s=(c[--p]==k)?this.DM:Math.floor(c[p]*m+(c[p-1]+o)*n);if((c[p]+=f.am(0,s,c,q,0,j))<s){f.dlShiftTo(q,r);c.subTo(r,c);while(c[p]<--s)c.subTo(r,c);}}if(b!=null){c.drShiftTo(j,b);if(g!=h)BigInteger.ZERO.subTo(b,b);}c.t=j;c.clamp();if(i>0)c.rShiftTo(i,c);if(g<0)BigInteger.ZERO.subTo(c,c);}function bnMod(a){var b=nbi();this.abs().divRemTo(a,null,b);if(this.s<0&&b.compareTo(BigInteger.ZERO)>0)a.subTo(b,b);return b;}function Classic(a){this.m=a;}function cConvert(a){if(a.s<0||a.compareTo(this.m)>=0)return a.mod(this.m);else return a;}function cRevert(a){return a;}function cReduce(a){a.divRemTo(this.m,null,a);}function cMulTo(a,b,c){a.multiplyTo(b,c);this.reduce(c);}function cSqrTo(a,b){a.squareTo(b);this.reduce(b);}Classic.prototype.convert=cConvert;Classic.prototype.revert=cRevert;Classic.prototype.reduce=cReduce;Classic.prototype.mulTo=cMulTo;Classic.prototype.sqrTo=cSqrTo;function bnpInvDigit(){if(this.t<1)return 0;var a=this[0];if((a&1)==0)return 0;var b=a&3;b=(b*(2-(a&0xf)*b))&0xf;b=(b*(2-(a&0xff)*b))&0xff;b=(b*(2-(((a&0xffff)*b)&0xffff)))&0xffff;b=(b*(2-a*b%this.DV))%this.DV;return(b>0)?this.DV-b:-b;}function Montgomery(a){this.m=a;this.mp=a.invDigit();this.mpl=this.mp&0x7fff;this.mph=this.mp>>15;this.um=(1<<(a.DB-15))-1;this.mt2=2*a.t;}function montConvert(a){var b=nbi();a.abs().dlShiftTo(this.m.t,b);b.divRemTo(this.m,null,b);if(a.s<0&&b.compareTo(BigInteger.ZERO)>0)this.m.subTo(b,b);return b;}function montRevert(a){var b=nbi();a.copyTo(b);this.reduce(b);return b;}function montReduce(a){while(a.t<=this.mt2)a[a.t++]=0;for(var b=0;b<this.m.t;++b){var c=a[b]&0x7fff;var d=(c*this.mpl+(((c*this.mph+(a[b]>>15)*this.mpl)&this.um)<<15))&a.DM;c=b+this.m.t;a[c]+=this.m.am(0,d,a,b,0,this.m.t);while(a[c]>=a.DV){a[c]-=a.DV;a[++c]++;}}a.clamp();a.drShiftTo(this.m.t,a);if(a.compareTo(this.m)>=0)a.subTo(this.m,a);}function montSqrTo(a,b){a.squareTo(b);this.reduce(b);}function montMulTo(a,b,c){a.multiplyTo(b,c);this.reduce(c);}Montgomery.prototype.convert=montConvert;Montgomery.prototype.revert=montRevert;Montgomery.prototype.reduce=montReduce;Montgomery.prototype.mulTo=montMulTo;Montgomery.prototype.sqrTo=montSqrTo;function bnpIsEven(){return((this.t>0)?(this[0]&1):this.s)==0;}function bnpExp(a,b){if(a>0xffffffff||a<1)return BigInteger.ONE;var c=nbi(),d=nbi(),e=b.convert(this),f=nbits(a)-1;e.copyTo(c);while(--f>=0){b.sqrTo(c,d);if((a&(1<<f))>0)b.mulTo(d,e,c);else{var g=c;c=d;d=g;}}return b.revert(c);}function bnModPowInt(a,b){var c;if(a<256||b.isEven())c=new Classic(b);else c=new Montgomery(b);return this.exp(a,c);}BigInteger.prototype.copyTo=bnpCopyTo;BigInteger.prototype.fromInt=bnpFromInt;BigInteger.prototype.fromString=bnpFromString;BigInteger.prototype.clamp=bnpClamp;BigInteger.prototype.dlShiftTo=bnpDLShiftTo;BigInteger.prototype.drShiftTo=bnpDRShiftTo;BigInteger.prototype.lShiftTo=bnpLShiftTo;BigInteger.prototype.rShiftTo=bnpRShiftTo;BigInteger.prototype.subTo=bnpSubTo;BigInteger.prototype.multiplyTo=bnpMultiplyTo;BigInteger.prototype.squareTo=bnpSquareTo;BigInteger.prototype.divRemTo=bnpDivRemTo;BigInteger.prototype.invDigit=bnpInvDigit;BigInteger.prototype.isEven=bnpIsEven;BigInteger.prototype.exp=bnpExp;BigInteger.prototype.toString=bnToString;BigInteger.prototype.negate=bnNegate;BigInteger.prototype.abs=bnAbs;BigInteger.prototype.compareTo=bnCompareTo;BigInteger.prototype.bitLength=bnBitLength;BigInteger.prototype.mod=bnMod;BigInteger.prototype.modPowInt=bnModPowInt;BigInteger.ZERO=nbv(0);BigInteger.ONE=nbv(1);";
-
-const char jsbn_1_js[] = "var dbits;var canary=0xdeadbeefcafe;var j_lm=((canary&0xffffff)==0xefcafe);function BigInteger(a,b,c){if(a!=null)if('number'==typeof a)this.fromNumber(a,b,c);else if(b==null&&'string'!=typeof a)this.fromString(a,256);else this.fromString(a,b);}function nbi(){return new BigInteger(null);}function am1(a,b,c,d,e,f){while(--f>=0){var g=b*this[a++]+c[d]+e;e=Math.floor(g/0x4000000);c[d++]=g&0x3ffffff;}return e;}function am2(a,b,c,d,e,f){var g=b&0x7fff,h=b>>15;while(--f>=0){var i=this[a]&0x7fff;var j=this[a++]>>15;var k=h*i+j*g;i=g*i+((k&0x7fff)<<15)+c[d]+(e&0x3fffffff);e=(i>>>30)+(k>>>15)+h*j+(e>>>30);c[d++]=i&0x3fffffff;}return e;}function am3(a,b,c,d,e,f){var g=b&0x3fff,h=b>>14;while(--f>=0){var i=this[a]&0x3fff;var j=this[a++]>>14;var k=h*i+j*g;i=g*i+((k&0x3fff)<<14)+c[d]+e;e=(i>>28)+(k>>14)+h*j;c[d++]=i&0xfffffff;}return e;}if(j_lm&&(navigator.appName=='Microsoft Internet Explorer')){BigInteger.prototype.am=am2;dbits=30;}else if(j_lm&&(navigator.appName!='Netscape')){BigInteger.prototype.am=am1;dbits=26;}else{BigInteger.prototype.am=am3;dbits=28;}BigInteger.prototype.DB=dbits;BigInteger.prototype.DM=((1<<dbits)-1);BigInteger.prototype.DV=(1<<dbits);var BI_FP=52;BigInteger.prototype.FV=Math.pow(2,BI_FP);BigInteger.prototype.F1=BI_FP-dbits;BigInteger.prototype.F2=2*dbits-BI_FP;var BI_RM='0123456789abcdefghijklmnopqrstuvwxyz';var BI_RC=new Array();var rr,vv;rr='0'.charCodeAt(0);for(vv=0;vv<=9;++vv)BI_RC[rr++]=vv;rr='a'.charCodeAt(0);for(vv=10;vv<36;++vv)BI_RC[rr++]=vv;rr='A'.charCodeAt(0);for(vv=10;vv<36;++vv)BI_RC[rr++]=vv;function int2char(a){return BI_RM.charAt(a);}function intAt(a,b){var c=BI_RC[a.charCodeAt(b)];return(c==null)?-1:c;}function bnpCopyTo(a){for(var b=this.t-1;b>=0;--b)a[b]=this[b];a.t=this.t;a.s=this.s;}function bnpFromInt(a){this.t=1;this.s=(a<0)?-1:0;if(a>0)this[0]=a;else if(a<-1)this[0]=a+this.DV;else this.t=0;}function nbv(a){var b=nbi();b.fromInt(a);return b;}function bnpFromString(a,b){var c;if(b==16)c=4;else if(b==8)c=3;else if(b==256)c=8;else if(b==2)c=1;else if(b==32)c=5;else if(b==4)c=2;else{this.fromRadix(a,b);return;}this.t=0;this.s=0;var d=a.length,e=false,f=0;while(--d>=0){var g=(c==8)?a[d]&0xff:intAt(a,d);if(g<0){if(a.charAt(d)=='-')e=true;continue;}e=false;if(f==0)this[this.t++]=g;else if(f+c>this.DB){this[this.t-1]|=(g&((1<<(this.DB-f))-1))<<f;this[this.t++]=(g>>(this.DB-f));}else this[this.t-1]|=g<<f;f+=c;if(f>=this.DB)f-=this.DB;}if(c==8&&(a[0]&0x80)!=0){this.s=-1;if(f>0)this[this.t-1]|=((1<<(this.DB-f))-1)<<f;}this.clamp();if(e)BigInteger.ZERO.subTo(this,this);}function bnpClamp(){var a=this.s&this.DM;while(this.t>0&&this[this.t-1]==a)--this.t;}function bnToString(a){if(this.s<0)return '-'+this.negate().toString(a);var b;if(a==16)b=4;else if(a==8)b=3;else if(a==2)b=1;else if(a==32)b=5;else if(a==4)b=2;else return this.toRadix(a);var c=(1<<b)-1,d,e=false,f='',g=this.t;var h=this.DB-(g*this.DB)%b;if(g-->0){if(h<this.DB&&(d=this[g]>>h)>0){e=true;f=int2char(d);}while(g>=0){if(h<b){d=(this[g]&((1<<h)-1))<<(b-h);d|=this[--g]>>(h+=this.DB-b);}else{d=(this[g]>>(h-=b))&c;if(h<=0){h+=this.DB;--g;}}if(d>0)e=true;if(e)f+=int2char(d);}}return e?f:'0';}function bnNegate(){var a=nbi();BigInteger.ZERO.subTo(this,a);return a;}function bnAbs(){return(this.s<0)?this.negate():this;}function bnCompareTo(a){var b=this.s-a.s;if(b!=0)return b;var c=this.t;b=c-a.t;if(b!=0)return(this.s<0)?-b:b;while(--c>=0)if((b=this[c]-a[c])!=0)return b;return 0;}function nbits(a){var b=1,c;if((c=a>>>16)!=0){a=c;b+=16;}if((c=a>>8)!=0){a=c;b+=8;}if((c=a>>4)!=0){a=c;b+=4;}if((c=a>>2)!=0){a=c;b+=2;}if((c=a>>1)!=0){a=c;b+=1;}return b;}function bnBitLength(){if(this.t<=0)return 0;return this.DB*(this.t-1)+nbits(this[this.t-1]^(this.s&this.DM));}function bnpDLShiftTo(a,b){var c;for(c=this.t-1;c>=0;--c)b[c+a]=this[c];for(c=a-1;c>=0;--c)b[c]=0;b.t=this.t+a;b.s=this.s;}function bnpDRShiftTo(a,b){for(var c=a;c<this.t;++c)b[c-a]=this[c];b.t=Math.max(this.t-a,0);b.s=this.s;}function bnpLShiftTo(a,b){var c=a%this.DB;var d=this.DB-c;var e=(1<<d)-1;var f=Math.floor(a/this.DB),g=(this.s<<c)&this.DM,h;for(h=this.t-1;h>=0;--h){b[h+f+1]=(this[h]>>d)|g;g=(this[h]&e)<<c;}for(h=f-1;h>=0;--h)b[h]=0;b[f]=g;b.t=this.t+f+1;b.s=this.s;b.clamp();}";
-
-const char script_js[] = "var base_url='http://192.168.0.1/';var network_list;var public_key;var rsa=new RSAKey();var scanButton=document.getElementById('scan-button');var connectButton=document.getElementById('connect-button');var copyButton=document.getElementById('copy-button');var showButton=document.getElementById('show-button');var deviceID=document.getElementById('device-id');var connectForm=document.getElementById('connect-form');var public_key_callback={success:function(a){console.log('Public key: '+a.b);public_key=a.b;rsa.setPublic(public_key.substring(58,58+256),public_key.substring(318,318+6));},error:function(a,b){console.log(a);window.alert('There was a problem fetching important information from your device. Please verify your connection, then reload this page.');}};var device_id_callback={success:function(a){var b=a.id;deviceID.value=b;},error:function(a,b){console.log(a);var c='COMMUNICATION_ERROR';deviceID.value=c;}};var scan=function(){console.log('Scanning...!');disableButtons();scanButton.innerHTML='Scanning...';connectButton.innerHTML='Connect';document.getElementById('connect-div').style.display='none';document.getElementById('networks-div').style.display='none';getRequest(base_url+'scan-ap',scan_callback);};var scan_callback={success:function(a){network_list=a.scans;console.log('I found:');var b=document.getElementById('networks-div');b.innerHTML='';if(network_list.length>0)for(var c=0;c<network_list.length;c++){ssid=network_list[c].ssid;console.log(network_list[c]);add_wifi_option(b,ssid);document.getElementById('connect-div').style.display='block';}else b.innerHTML='<p class=\\'scanning-error\\'>No networks found.</p>';},error:function(a){console.log('Scanning error:'+a);document.getElementById('networks-div').innerHTML='<p class=\\'scanning-error\\'>Scanning error.</p>';},regardless:function(){scanButton.innerHTML='Re-Scan';enableButtons();document.getElementById('networks-div').style.display='block';}};var configure=function(a){a.preventDefault();var b=get_selected_network();var c=document.getElementById('password').value;if(!b){window.alert('Please select a network!');return false;}var d={idx:0,ssid:b.ssid,pwd:rsa.encrypt(c),sec:b.sec,ch:b.ch};connectButton.innerHTML='Sending credentials...';disableButtons();console.log('Sending credentials: '+JSON.stringify(d));postRequest(base_url+'configure-ap',d,configure_callback);};var configure_callback={success:function(a){console.log('Credentials received.');connectButton.innerHTML='Credentials received...';postRequest(base_url+'connect-ap',{idx:0},connect_callback);},error:function(a,b){console.log('Configure error: '+a);window.alert('The configuration command failed, check that you are still well connected to the lamp\\'s WiFi hotspot and retry.');connectButton.innerHTML='Retry';enableButtons();}};var connect_callback={success:function(a){console.log('Attempting to connect to the cloud.');connectButton.innerHTML='Attempting to connect...';window.alert('Your lamp should now start flashing green and attempt to connect to the cloud. This usually takes about 20 seconds, after which it will slowly pulse cyan for 10 seconds to indicate it is connected, then cycle through some colours before turning off the lamp and waiting for instructions! \\n\\n\\nIf the lamp fails to connect (e.g wrong password), the device will flash green for 60 seconds, then revert to flashing blue. While it is flashing blue, you can then reconnect to the WiFi hotspot it generates and reload this page to try again.');},error:function(a,b){console.log('Connect error: '+a);window.alert('The connect command failed, check that you are still connected to the lamp\\'s WiFi hotspot and retry.');connectButton.innerHTML='Retry';enableButtons();}};var disableButtons=function(){connectButton.disabled=true;scanButton.disabled=true;};var enableButtons=function(){connectButton.disabled=false;scanButton.disabled=false;};var add_wifi_option=function(a,b){var c=document.createElement('INPUT');c.type='radio';c.value=b;c.id=b;c.name='ssid';c.className='radio';var d=document.createElement('DIV');d.className='radio-div';d.appendChild(c);var e=document.createElement('label');e.htmlFor=b;e.innerHTML=b;d.appendChild(e);a.appendChild(d);};var get_selected_network=function(){for(var a=0;a<network_list.length;a++){ssid=network_list[a].ssid;if(document.getElementById(ssid).checked)return network_list[a];}};var copy=function(){window.prompt('Copy to clipboard: Ctrl + C, Enter',deviceID.value);};var toggleShow=function(){var a=document.getElementById('password');inputType=a.type;if(inputType==='password'){showButton.innerHTML='Hide';a.type='text';}else{showButton.innerHTML='Show';a.type='password';}};var getRequest=function(a,b){var c=new XMLHttpRequest();c.open('GET',a,true);c.timeout=8000;c.send();c.onreadystatechange=function(){if(c.readyState==4)if(b){if(c.status==200){if(b.success)b.success(JSON.parse(c.responseText));}else if(b.error)b.error(c.status,c.responseText);if(b.regardless)b.regardless();}};};var postRequest=function(a,b,c){var d=JSON.stringify(b);var e=new XMLHttpRequest();e.open('POST',a,true);e.timeout=4000;e.setRequestHeader('Content-Type','multipart/form-data');e.send(d);e.onreadystatechange=function(){if(e.readyState==4)if(c){if(e.status==200){if(c.success)c.success(JSON.parse(e.responseText));}else if(c.error)c.error(e.status,e.responseText);if(c.regardless)c.regardless();}};};if(scanButton.addEventListener){copyButton.addEventListener('click',copy);showButton.addEventListener('click',toggleShow);scanButton.addEventListener('click',scan);connectForm.addEventListener('submit',configure);}else if(scanButton.attachEvent){copyButton.attachEvent('onclick',copy);showButton.attachEvent('onclick',toggleShow);scanButton.attachEvent('onclick',scan);connectForm.attachEvent('onsubmit',configure);}getRequest(base_url+'device-id',device_id_callback);getRequest(base_url+'public-key',public_key_callback);";
-
-const char prng4_js[] = "function Arcfour(){this.i=0;this.j=0;this.S=new Array();}function ARC4init(a){var b,c,d;for(b=0;b<256;++b)this.S[b]=b;c=0;for(b=0;b<256;++b){c=(c+this.S[b]+a[b%a.length])&255;d=this.S[b];this.S[b]=this.S[c];this.S[c]=d;}this.i=0;this.j=0;}function ARC4next(){var a;this.i=(this.i+1)&255;this.j=(this.j+this.S[this.i])&255;a=this.S[this.i];this.S[this.i]=this.S[this.j];this.S[this.j]=a;return this.S[(a+this.S[this.i])&255];}Arcfour.prototype.init=ARC4init;Arcfour.prototype.next=ARC4next;function prng_newstate(){return new Arcfour();}var rng_psize=256;";
+// strcmp(), at compile time
+constexpr int routeOrder(const char* a, const char* b)
+{
+    return (*a != *b || *a == 0) ? (uint8_t)*a - (uint8_t)*b : routeOrder(a + 1, b + 1);
+}
 
+constexpr bool wifiRoutesSorted(int route)
+{
+    return route >= NUM_WIFI_ROUTES - 1 || (routeOrder(wifiRoutes[route].url, wifiRoutes[route + 1].url) < 0 && wifiRoutesSorted(route + 1));
+}
 
-Page myPages[] = {
-     { "/index.html", "text/html", index_html },
-     { "/rsa-utils/rsa.js", "application/javascript", rsa_js },
-     { "/style.css", "text/css", style_css },
-     { "/rsa-utils/rng.js", "application/javascript", rng_js },
-     { "/rsa-utils/jsbn_2.js", "application/javascript", jsbn_2_js },
-     { "/rsa-utils/jsbn_1.js", "application/javascript", jsbn_1_js },
-     { "/script.js", "application/javascript", script_js },
-     { "/rsa-utils/prng4.js", "application/javascript", prng4_js },
-     { nullptr }
-};
+static_assert(wifiRoutesSorted(0), "wifi-pages.h is out of date: run python/softapPages.py");
 
-void setupWiFiPage(const char* url, ResponseCallback* cb, void* cbArg, Reader* body, Writer* result, void* reserved)
+// Compares a route's URL with the path in url, as strcmp() would: a query string ends the path.
+// end is left where they stopped matching
+static int comparePath(const char* route, const char* url, const char** end)
 {
-    if (strcmp(url,"/index")==0) {
-        Header h("Location: /index.html\r\n");
-        cb(cbArg, 0, 301, "text/plain", &h);
-        return;
+    while (*route && *route == *url) {
+        route++;
+        url++;
     }
+    
+    *end = url;
+    
+    return (uint8_t)*route - (*url == '?' ? 0 : (uint8_t)*url);
+}
 
-    int8_t idx = 0;
-    for (;;idx++) {
-        Page& p = myPages[idx];
-        if (!p.url) {
-            idx = -1;
+// The routes are sorted by URL, so the scan stops at the first one past the path. A prefix route sorts before
+// everything under it: it is kept in case nothing matches exactly
+const Page* findWifiRoute(const char* url, const char** rest)
+{
+    const Page* under = nullptr;
+    
+    for (const Page& route : wifiRoutes) {
+        const char* end;
+        int order = comparePath(route.url, url, &end);
+        
+        if (order > 0) {
             break;
         }
-        else if (strcmp(url, p.url)==0) {
-            break;
+        
+        if (order == 0 && !route.prefix) {
+            *rest = end;
+            return &route;
+        }
+        
+        // The whole of a prefix route's URL matched: the path is under it
+        if (route.prefix && route.url[end - url] == 0) {
+            under = &route;
+            *rest = end;
         }
     }
+    
+    return under;
+}
 
-    if (idx==-1) {
+// /status/boot and /status/profile: what the cloud variables would say, for when the cloud is out of reach
+void statusPage(const char* rest, ResponseCallback* cb, void* cbArg, Writer* result)
+{
+    const char* text = nullptr;
+    
+    if (strncmp(rest, "boot", 4) == 0) {
+        text = bootReport;
+    }
+#if LAMP_PROFILE
+    else if (strncmp(rest, "profile", 7) == 0) {
+        text = profileReport;
+    }
+#endif
+    
+    if (!text) {
         cb(cbArg, 0, 404, nullptr, nullptr);
+        return;
+    }
+    
+    cb(cbArg, 0, 200, "text/plain", nullptr);
+    result->write(text);
+}
+
+// The pages are gzipped and embedded by python/softapPages.py (from softap/), along with their headers.
+// The SoftAP server doesn't pass on the request headers, so there is no If-None-Match to answer with a 304:
+// the ETag and Cache-Control headers let the browser skip asking again instead
+void setupWiFiPage(const char* url, ResponseCallback* cb, void* cbArg, Reader* /*body*/, Writer* result, void* /*reserved*/)
+{
+    const char* rest;
+    const Page* p = findWifiRoute(url, &rest);
+    
+    if (!p) {
+        cb(cbArg, 0, 404, nullptr, nullptr);
+    }
+    else if (p->handler) {
+        p->handler(rest, cb, cbArg, result);
     }
     else {
-        cb(cbArg, 0, 200, myPages[idx].mime_type, nullptr);
-        result->write(myPages[idx].data);
+        Header h(p->headers);
+        
+        cb(cbArg, 0, p->status, p->mime_type, &h);
+        
+        for (size_t sent = 0; sent < p->length; sent += WIFI_PAGE_CHUNK) {
+            size_t chunk = p->length - sent;
+            
+            result->write(p->data + sent, chunk < WIFI_PAGE_CHUNK ? chunk : WIFI_PAGE_CHUNK);
+        }
     }
 }
 
+char connectionReport[CONNECTION_REPORT_LENGTH];
+
+static const char *connectionStateNames[NUM_CONNECTION_STATES] = { "connected", "connecting", "listening" };
+
+// System event handlers are plain functions
+static void connectionEventHandler(system_event_t event, int param)
+{
+    conn.onSystemEvent(event, param);
+}
+
 // Manage our connection state for us
-// We init ourselves to "CONNECTED" state, but the first check will drop us out of that state
-Connection::Connection(void) : currentConnectionStatus(true)
+// We start off CONNECTING: begin() finds out where we really are
+Connection::Connection(void) :
+    cloudRecoveryState(CONNECTING),
+    lastStateChange(0),
+    lostAt(0),
+    backoffMs(RECONNECT_MIN_MS),
+    stateChanges(),
+    timeInState(),
+    reconnectAttempts(0),
+    lastRecoveryMs(0),
+    worstRecoveryMs(0)
 {
-    cloudRecoveryState = CONNECTED;
-};
+}
 
+void Connection::begin(void)
+{
+    static bool registered = false;
+    
+    if( !registered)
+    {
+        System.on(network_status | cloud_status, connectionEventHandler);
+        registered = true;
+    }
+    
+    lastStateChange = millis();
+    
+    if( Particle.connected())
+    {
+        changeState(CONNECTED);
+    }
+    else
+    {
+        lostConnection();
+    }
+}
 
-// Sets the colour resolution of the PWM pins (and set them to be outputs, just in case)
 bool Connection::isConnected(void)
 {
-    return (currentConnectionStatus);  
+    return cloudRecoveryState == CONNECTED;
 }
 
-bool Connection::updateConnectionStatus(void)
+uint32_t Connection::getConnections(void)
 {
-    bool oldStatus = currentConnectionStatus;
-    
-    currentConnectionStatus = Particle.connected();
-    
-    if( oldStatus != currentConnectionStatus)
+    return stateChanges[CONNECTED];
+}
+
+void Connection::onSystemEvent(system_event_t event, int param)
+{
+    if( event == cloud_status && param == cloud_status_connected)
     {
-        lastStateChange = millis();
-        
-        // If we just lost the cloud connection, we will go into "CONNECTING" recovery state
-        if( !currentConnectionStatus)
+        if( cloudRecoveryState != CONNECTED)
         {
-            // If we have stored credentials, then we will be CONNECTING
-            // Otherwise we will be LISTENING
-            if( WiFi.hasCredentials())
-            {
-                cloudRecoveryState = CONNECTING;
-            }
-            else
-            {
-                cloudRecoveryState = LISTENING;
-            }
+            reconnectTimer.stop();
+            
+            lastRecoveryMs = millis() - lostAt;
+            if( lastRecoveryMs > worstRecoveryMs) worstRecoveryMs = lastRecoveryMs;
+            
+            changeState(CONNECTED);
         }
-        else
+    }
+    else if( (event == cloud_status && param == cloud_status_disconnected) ||
+             (event == network_status && param == network_status_disconnected))
+    {
+        if( cloudRecoveryState == CONNECTED) lostConnection();
+    }
+    else if( event == network_status && param == network_status_connected)
+    {
+        // The network is back: no point waiting out the backoff before asking for the cloud
+        if( cloudRecoveryState == CONNECTING)
         {
-            cloudRecoveryState = CONNECTED;
+            backoffMs = RECONNECT_MIN_MS;
+            onReconnectTimer();
         }
     }
+}
+
+// If we have stored credentials, then we will be CONNECTING. Otherwise we will be LISTENING
+void Connection::lostConnection(void)
+{
+    lostAt = millis();
+    backoffMs = RECONNECT_MIN_MS;
     
-    return currentConnectionStatus;
+    if( WiFi.hasCredentials())
+    {
+        changeState(CONNECTING);
+        reconnectTimer.changePeriod(backoffMs);
+    }
+    else
+    {
+        changeState(LISTENING);
+    }
 }
 
+// Ask for the cloud again, and set when to ask next if that doesn't work
+void Connection::onReconnectTimer(void)
+{
+    if( cloudRecoveryState != CONNECTING)
+    {
+        return;
+    }
+    
+    reconnectAttempts++;
+    Particle.connect();
+    
+    backoffMs *= 2;
+    if( backoffMs > RECONNECT_MAX_MS) backoffMs = RECONNECT_MAX_MS;
+    
+    reconnectTimer.changePeriod(backoffMs);
+}
+
+void Connection::changeState(int newState)
+{
+    unsigned long now = millis();
+    
+    timeInState[cloudRecoveryState] += now - lastStateChange;
+    stateChanges[newState]++;
+    
+    cloudRecoveryState = newState;
+    lastStateChange = now;
+}
 
 // Our "connection recovery" status
 int Connection::getCloudRecoveryState(void)
@@ -155,14 +292,16 @@ void Connection::setCloudRecoveryState(int newState)
         {
             if( WiFi.hasCredentials() )
             {
-                cloudRecoveryState = newState;
-                lastStateChange = millis();                
+                changeState(newState);
+                backoffMs = RECONNECT_MIN_MS;
+                reconnectTimer.changePeriod(backoffMs);
             }
         }
         else
         {
-            cloudRecoveryState = newState;
-            lastStateChange = millis();              
+            // Listening (or told we are connected): stop asking for the cloud
+            reconnectTimer.stop();
+            changeState(newState);
         }
     }
 }
@@ -177,5 +316,45 @@ unsigned long Connection::mSecSinceLastStateChange(void)
     return (millis() - lastStateChange);
 }
 
+uint32_t Connection::getStateChanges(int state)
+{
+    return state < NUM_CONNECTION_STATES ? stateChanges[state] : 0;
+}
 
+// Including the time so far in the state we're in now
+uint32_t Connection::getTimeInState(int state)
+{
+    if( state >= NUM_CONNECTION_STATES)
+    {
+        return 0;
+    }
+    
+    return timeInState[state] + (state == cloudRecoveryState ? mSecSinceLastStateChange() : 0);
+}
 
+uint32_t Connection::getReconnectAttempts(void)
+{
+    return reconnectAttempts;
+}
+
+uint32_t Connection::getLastRecoveryMs(void)
+{
+    return lastRecoveryMs;
+}
+
+uint32_t Connection::getWorstRecoveryMs(void)
+{
+    return worstRecoveryMs;
+}
+
+// For the "connection" variable: the state, then changes and seconds in each state, reconnect attempts
+// and the last and worst recovery times in ms
+void Connection::updateReport(void)
+{
+    snprintf(connectionReport, sizeof(connectionReport), "%s connected=%lu/%lus connecting=%lu/%lus listening=%lu/%lus attempts=%lu recovery=%lu worst=%lu",
+             connectionStateNames[cloudRecoveryState],
+             (unsigned long)stateChanges[CONNECTED], (unsigned long)getTimeInState(CONNECTED) / 1000,
+             (unsigned long)stateChanges[CONNECTING], (unsigned long)getTimeInState(CONNECTING) / 1000,
+             (unsigned long)stateChanges[LISTENING], (unsigned long)getTimeInState(LISTENING) / 1000,
+             (unsigned long)reconnectAttempts, (unsigned long)lastRecoveryMs, (unsigned long)worstRecoveryMs);
+}
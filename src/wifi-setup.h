@@ -38,37 +38,62 @@
 #include "Particle.h"
 #include "softap_http.h"
 
+// Makes the body of a dynamic page. For a prefix route, rest is the URL after the prefix
+typedef void (PageHandler)(const char* rest, ResponseCallback* cb, void* cbArg, Writer* result);
+
+// A route: a static page (gzipped data), a redirect (status 301, with a Location header) or a handler
 struct Page
 {
     const char* url;
+    uint16_t status;
     const char* mime_type;
-    const char* data;
+    const uint8_t* data;        // gzipped
+    size_t length;
+    const char* headers;        // Content-Encoding, Content-Length, ETag and Cache-Control, or Location
+    PageHandler* handler;
+    bool prefix;                // url ends in '/', and matches everything under it
 };
 
+// Pages are written out this much at a time, so the SoftAP stack never needs to buffer a whole one
+#define WIFI_PAGE_CHUNK     512
+
 #define CONNECTED   0
 #define CONNECTING  1
 #define LISTENING   2
+#define NUM_CONNECTION_STATES   3
 
-// Hardcoded page definitions 
-extern const char index_html[];
-extern const char rsa_js[];
-extern const char style_css[];
-extern const char rng_js[];
-extern const char jsbn_2_js[];
-extern const char jsbn_1_js[];
-extern const char script_js[];
-extern const char prng4_js[];
+// The route for a URL (ignoring any query string), or nullptr. An exact match first, then a prefix route
+const Page* findWifiRoute(const char* url, const char** rest);
 
 void setupWiFiPage(const char* url, ResponseCallback* cb, void* cbArg, Reader* body, Writer* result, void* reserved);
 
 
+// How long we try the stored networks before giving up and going into listening mode
+#define LISTEN_TIMEOUT_MS   120000
+
+// Reconnect attempts start this long after losing the cloud, and back off (doubling) to at most RECONNECT_MAX_MS apart
+#define RECONNECT_MIN_MS    1000
+#define RECONNECT_MAX_MS    32000
+
+#define CONNECTION_REPORT_LENGTH    160
+
+/*
+ * Tracks our connection to the cloud from the system's network and cloud events, rather than by polling.
+ * When the connection drops, it asks for it back on a timer, backing off exponentially, and it keeps
+ * counts of changes, time spent in each state and how long recovery took
+ */
 class Connection
 {
     public:
         Connection(void);
         
+        // Register for system events: call from setup()
+        void begin(void);
+        
         bool isConnected(void);
-        bool updateConnectionStatus(void);
+        
+        // Goes up by one each time we get the cloud (back)
+        uint32_t getConnections(void);
         
         int getCloudRecoveryState(void);
         void setCloudRecoveryState(int);
@@ -76,11 +101,36 @@ class Connection
         unsigned long getLastStateChange(void);
         unsigned long mSecSinceLastStateChange(void);
         
+        // Telemetry: how many times each state has been entered, and the total time spent in it
+        uint32_t getStateChanges(int state);
+        uint32_t getTimeInState(int state);
+        uint32_t getReconnectAttempts(void);
+        uint32_t getLastRecoveryMs(void);
+        uint32_t getWorstRecoveryMs(void);
+        void updateReport(void);
+        
+        // The system event handler, and the reconnect timer
+        void onSystemEvent(system_event_t event, int param);
+        void onReconnectTimer(void);
+        
     private:
-        bool currentConnectionStatus; 
-        int  cloudRecoveryState;
+        void changeState(int newState);
+        void lostConnection(void);
+        
+        volatile int cloudRecoveryState;
         unsigned long lastStateChange;
+        unsigned long lostAt;
+        uint32_t backoffMs;
+        
+        uint32_t stateChanges[NUM_CONNECTION_STATES];
+        uint32_t timeInState[NUM_CONNECTION_STATES];
+        uint32_t reconnectAttempts;
+        uint32_t lastRecoveryMs;
+        uint32_t worstRecoveryMs;
 };
 
+extern Connection conn;
+extern Timer reconnectTimer;
+extern char connectionReport[CONNECTION_REPORT_LENGTH];
 
 #endif